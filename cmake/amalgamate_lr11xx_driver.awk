@@ -0,0 +1,232 @@
+################################################################################
+#
+# Copyright (c) 2024, UnaBiz SAS
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#  1 Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#  2 Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+#    used to endorse or promote products derived from this software without
+#    specific prior written permission.
+#
+# NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+# THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+# CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+# PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+# CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+# BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+# IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+################################################################################
+
+# Extract from the LR11XX driver sources the functions referenced by the RF API.
+# Usage: awk -v preprocessed=<preprocessed RF API sources> -f amalgamate_lr11xx_driver.awk <driver sources>
+# The roots are the identifiers found in the lines of the preprocessed file coming from the src/manuf sources, so that
+# only the code enabled by the active flags is taken into account (declarations of the included headers are ignored).
+# Top level items are split in chunks (preprocessor lines, comments, declarations and function definitions).
+# Functions, static prototypes and static variables are symbols: they are only kept if they are referenced by the roots,
+# directly or through another kept symbol. Files without any kept function are dropped.
+
+function flush_pending() {
+    if (pending != "") {
+        add_chunk("text", "", pending, "");
+        pending = "";
+    }
+}
+
+function add_chunk(type, name, text, refs) {
+    nchunks[nfiles]++;
+    chunk_type[nfiles, nchunks[nfiles]] = type;
+    chunk_name[nfiles, nchunks[nfiles]] = name;
+    chunk_text[nfiles, nchunks[nfiles]] = text;
+    if (name != "") {
+        defined[name] = nfiles;
+        symbol_refs[name] = symbol_refs[name] " " refs;
+    }
+}
+
+# Remove comments and string literals from a line of code, the state is kept across lines for block comments.
+function strip_code(line,    out, c, i) {
+    out = "";
+    for (i = 1; i <= length(line); i++) {
+        c = substr(line, i, 1);
+        if (in_block_comment) {
+            if (substr(line, i, 2) == "*/") {
+                in_block_comment = 0;
+                i++;
+            }
+        } else if (substr(line, i, 2) == "/*") {
+            in_block_comment = 1;
+            i++;
+        } else if (substr(line, i, 2) == "//") {
+            break;
+        } else if ((c == "\"") || (c == "'")) {
+            i++;
+            while ((i <= length(line)) && (substr(line, i, 1) != c)) {
+                if (substr(line, i, 1) == "\\") {
+                    i++;
+                }
+                i++;
+            }
+            out = out " ";
+        } else {
+            out = out c;
+        }
+    }
+    return out;
+}
+
+function identifiers(code,    refs, id) {
+    refs = "";
+    while (match(code, /[A-Za-z_][A-Za-z0-9_]*/)) {
+        id = substr(code, RSTART, RLENGTH);
+        refs = refs " " id;
+        code = substr(code, RSTART + RLENGTH);
+    }
+    return refs;
+}
+
+function close_chunk(    head, name, type, brace, paren, equal) {
+    paren = index(code_chunk, "(");
+    brace = index(code_chunk, "{");
+    equal = index(code_chunk, "=");
+    type = "text";
+    name = "";
+    if ((paren > 0) && ((brace == 0) || (paren < brace)) && ((equal == 0) || (paren < equal)) && (code_chunk !~ /^[ \t\n]*typedef/)) {
+        head = substr(code_chunk, 1, paren - 1);
+        if (match(head, /[A-Za-z_][A-Za-z0-9_]*[ \t\n]*$/)) {
+            name = substr(head, RSTART, RLENGTH);
+            sub(/[ \t\n]+$/, "", name);
+            if (brace > 0) {
+                type = "function";
+            } else if (code_chunk ~ /^[ \t\n]*static[ \t\n]/) {
+                type = "prototype";
+            } else {
+                name = "";
+            }
+        }
+    } else if (code_chunk ~ /^[ \t\n]*static[ \t\n]/) {
+        # Static variable: name is the last identifier before the initializer or the array size.
+        head = code_chunk;
+        sub(/[=\[;].*$/, "", head);
+        if (match(head, /[A-Za-z_][A-Za-z0-9_]*[ \t\n]*$/)) {
+            name = substr(head, RSTART, RLENGTH);
+            sub(/[ \t\n]+$/, "", name);
+            type = "variable";
+        }
+    }
+    add_chunk(type, name, pending text_chunk, (type == "function") ? identifiers(substr(code_chunk, brace)) : identifiers(code_chunk));
+    pending = "";
+    text_chunk = "";
+    code_chunk = "";
+}
+
+BEGIN {
+    root_line = 0;
+    while ((getline line < preprocessed) > 0) {
+        if (line ~ /^#[ \t]*(line[ \t]+)?[0-9]+[ \t]+"/) {
+            # Line marker: check if the following lines come from an RF API source.
+            root_line = (line ~ /"([^"]*\/)?src\/manuf\/[^\/"]*\.c"/);
+        } else if (root_line) {
+            count = split(identifiers(line), ids, " ");
+            for (i = 1; i <= count; i++) {
+                kept[ids[i]] = 1;
+            }
+        }
+    }
+    close(preprocessed);
+    nfiles = 0;
+}
+
+FNR == 1 {
+    flush_pending();
+    nfiles++;
+    file_name[nfiles] = FILENAME;
+    nchunks[nfiles] = 0;
+    depth = 0;
+    text_chunk = "";
+    code_chunk = "";
+    in_block_comment = 0;
+    in_directive = 0;
+}
+
+{
+    if ((depth == 0) && (text_chunk == "")) {
+        # Top level comments are attached to the next item, preprocessor lines and blank lines are kept as is.
+        if (in_block_comment) {
+            pending = pending $0 "\n";
+            strip_code($0);
+            next;
+        }
+        if (in_directive || ($0 ~ /^[ \t]*#/)) {
+            flush_pending();
+            add_chunk("text", "", $0 "\n", "");
+            in_directive = ($0 ~ /\\$/);
+            next;
+        }
+        if ($0 ~ /^[ \t]*$/) {
+            flush_pending();
+            add_chunk("text", "", $0 "\n", "");
+            next;
+        }
+        if (($0 ~ /^[ \t]*\/[\/*]/) && (strip_code($0) ~ /^[ \t]*$/)) {
+            pending = pending $0 "\n";
+            next;
+        }
+    }
+    text_chunk = text_chunk $0 "\n";
+    line_code = strip_code($0);
+    code_chunk = code_chunk line_code "\n";
+    depth += gsub(/\{/, "{", line_code) - gsub(/\}/, "}", line_code);
+    if ((depth == 0) && (line_code ~ /[;}][ \t]*$/)) {
+        close_chunk();
+    }
+}
+
+END {
+    flush_pending();
+    # Keep all the symbols reachable from the roots.
+    do {
+        changed = 0;
+        for (name in defined) {
+            if (!(name in kept)) {
+                continue;
+            }
+            count = split(symbol_refs[name], refs, " ");
+            for (i = 1; i <= count; i++) {
+                if ((refs[i] in defined) && !(refs[i] in kept)) {
+                    kept[refs[i]] = 1;
+                    changed = 1;
+                }
+            }
+        }
+    } while (changed);
+    for (f = 1; f <= nfiles; f++) {
+        used = 0;
+        for (c = 1; c <= nchunks[f]; c++) {
+            if ((chunk_type[f, c] == "function") && (chunk_name[f, c] in kept)) {
+                used = 1;
+            }
+        }
+        if (!used) {
+            continue;
+        }
+        printf("/* --- %s --- */\n", file_name[f]);
+        for (c = 1; c <= nchunks[f]; c++) {
+            if ((chunk_type[f, c] == "text") || (chunk_name[f, c] in kept)) {
+                printf("%s", chunk_text[f, c]);
+            }
+        }
+    }
+}
@@ -0,0 +1,132 @@
+################################################################################
+#
+# Copyright (c) 2024, UnaBiz SAS
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#  1 Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#  2 Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+#    used to endorse or promote products derived from this software without
+#    specific prior written permission.
+#
+# NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+# THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+# CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+# PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+# CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+# BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+# IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+################################################################################
+
+# Amalgamation of the RF API, the DBPSK encoder and the referenced LR11XX driver functions.
+# Included by the project, it adds the amalgamation_<project> target. The assembly step runs this file in script mode:
+# cmake -DAWK=<awk> -DLR11XX_RF_API_AMALGAMATION_SOURCES="<sources separated by |>" -DLR11XX_RF_API_AMALGAMATION_PREPROCESSED=<file>
+#       -DLR11XX_RF_API_AMALGAMATION_SOURCE=<output file> -DLR11XX_DRIVER_SOURCE_DIR=<driver sources> -P cmake/amalgamate_lr11xx_rf_api.cmake
+
+#Script mode: concatenate the sources and the driver functions extracted by the awk script
+if (CMAKE_SCRIPT_MODE_FILE STREQUAL CMAKE_CURRENT_LIST_FILE)
+    foreach(X IN ITEMS AWK LR11XX_RF_API_AMALGAMATION_SOURCES LR11XX_RF_API_AMALGAMATION_PREPROCESSED LR11XX_RF_API_AMALGAMATION_SOURCE LR11XX_DRIVER_SOURCE_DIR)
+        if (NOT DEFINED ${X})
+            message(FATAL_ERROR "${X} must be defined")
+        endif()
+    endforeach()
+    string(REPLACE "|" ";" LR11XX_RF_API_AMALGAMATION_SOURCES "${LR11XX_RF_API_AMALGAMATION_SOURCES}")
+    #The driver is fetched at build time, its sources are listed when the step runs
+    file(GLOB LR11XX_DRIVER_SOURCES ${LR11XX_DRIVER_SOURCE_DIR}/*.c)
+    if (NOT LR11XX_DRIVER_SOURCES)
+        message(FATAL_ERROR "No LR11XX driver source found in ${LR11XX_DRIVER_SOURCE_DIR}")
+    endif()
+    list(SORT LR11XX_DRIVER_SOURCES)
+    execute_process(
+        COMMAND ${AWK} -v preprocessed=${LR11XX_RF_API_AMALGAMATION_PREPROCESSED} -f ${CMAKE_CURRENT_LIST_DIR}/amalgamate_lr11xx_driver.awk ${LR11XX_DRIVER_SOURCES}
+        OUTPUT_VARIABLE DRIVER_CONTENT
+        RESULT_VARIABLE AWK_RESULT
+    )
+    if (NOT AWK_RESULT EQUAL 0)
+        message(FATAL_ERROR "LR11XX driver extraction failed (${AWK_RESULT})")
+    endif()
+    set(CONTENT "/* Generated by cmake/amalgamate_lr11xx_rf_api.cmake: LR11XX RF API, DBPSK encoder and referenced LR11XX driver functions. */\n")
+    foreach(X IN LISTS LR11XX_RF_API_AMALGAMATION_SOURCES)
+        file(READ ${X} SOURCE_CONTENT)
+        string(APPEND CONTENT "${SOURCE_CONTENT}")
+    endforeach()
+    string(APPEND CONTENT "${DRIVER_CONTENT}")
+    file(WRITE ${LR11XX_RF_API_AMALGAMATION_SOURCE} "${CONTENT}")
+    return()
+endif()
+
+#Amalgamation files
+set(AMALGAMATION_DIR ${CMAKE_BINARY_DIR}/amalgamation)
+set(LR11XX_RF_API_AMALGAMATION_SOURCE ${AMALGAMATION_DIR}/lr11xx_rf_api_amalgamation.c)
+set(LR11XX_RF_API_AMALGAMATION_PREPROCESSED ${AMALGAMATION_DIR}/lr11xx_rf_api_amalgamation.i)
+set(LR11XX_RF_API_AMALGAMATION_ROOTS ${AMALGAMATION_DIR}/lr11xx_rf_api_amalgamation_roots.c)
+if (NOT DEFINED LR11XX_DRIVER_SOURCE_DIR)
+    set(LR11XX_DRIVER_SOURCE_DIR ${CMAKE_CURRENT_BINARY_DIR}/drivers-src/lr11xx/src)
+endif()
+
+#Flags given at directory level (add_definitions) are used by the RF API objects as well
+get_directory_property(LR11XX_RF_API_DIRECTORY_DEFINITIONS COMPILE_DEFINITIONS)
+
+#RF API and encoder sources (board sources are kept apart to be replaced by the device manufacturer)
+set(LR11XX_RF_API_AMALGAMATION_SOURCES ${LR11XX_RF_API_SOURCES})
+list(FILTER LR11XX_RF_API_AMALGAMATION_SOURCES INCLUDE REGEX "^src/manuf/")
+list(TRANSFORM LR11XX_RF_API_AMALGAMATION_SOURCES PREPEND ${CMAKE_CURRENT_SOURCE_DIR}/)
+set(LR11XX_RF_API_AMALGAMATION_BOARD_SOURCES ${LR11XX_RF_API_SOURCES})
+list(FILTER LR11XX_RF_API_AMALGAMATION_BOARD_SOURCES INCLUDE REGEX "^src/board/")
+
+#The RF API sources are preprocessed together through a single file including them (written only when it changes)
+set(ROOTS_CONTENT "/* Generated by cmake/amalgamate_lr11xx_rf_api.cmake: RF API sources preprocessed to find the referenced LR11XX driver functions. */\n")
+foreach(X IN LISTS LR11XX_RF_API_AMALGAMATION_SOURCES)
+    string(APPEND ROOTS_CONTENT "#include \"${X}\"\n")
+endforeach()
+file(WRITE ${LR11XX_RF_API_AMALGAMATION_ROOTS}.tmp "${ROOTS_CONTENT}")
+configure_file(${LR11XX_RF_API_AMALGAMATION_ROOTS}.tmp ${LR11XX_RF_API_AMALGAMATION_ROOTS} COPYONLY)
+string(REPLACE ";" "|" LR11XX_RF_API_AMALGAMATION_SOURCES_ARG "${LR11XX_RF_API_AMALGAMATION_SOURCES}")
+
+add_custom_command(
+	OUTPUT ${LR11XX_RF_API_AMALGAMATION_SOURCE}
+	DEPENDS ${LR11XX_RF_API_AMALGAMATION_SOURCES}
+	DEPENDS ${LR11XX_RF_API_HEADERS}
+	DEPENDS ${LR11XX_RF_API_AMALGAMATION_ROOTS}
+	DEPENDS ${CMAKE_CURRENT_LIST_DIR}/amalgamate_lr11xx_driver.awk
+	DEPENDS ${CMAKE_CURRENT_LIST_FILE}
+	WORKING_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}
+	COMMAND ${CMAKE_C_COMPILER} -E "-I$<JOIN:$<TARGET_PROPERTY:${PROJECT_NAME}_obj,INCLUDE_DIRECTORIES>,;-I>" "$<$<BOOL:$<TARGET_PROPERTY:${PROJECT_NAME}_obj,COMPILE_DEFINITIONS>>:-D$<JOIN:$<TARGET_PROPERTY:${PROJECT_NAME}_obj,COMPILE_DEFINITIONS>,;-D>>" "$<$<BOOL:${LR11XX_RF_API_DIRECTORY_DEFINITIONS}>:-D$<JOIN:${LR11XX_RF_API_DIRECTORY_DEFINITIONS},;-D>>" ${LR11XX_RF_API_AMALGAMATION_ROOTS} -o ${LR11XX_RF_API_AMALGAMATION_PREPROCESSED}
+	COMMAND ${CMAKE_COMMAND} -DAWK=${AWK} "-DLR11XX_RF_API_AMALGAMATION_SOURCES=${LR11XX_RF_API_AMALGAMATION_SOURCES_ARG}" -DLR11XX_RF_API_AMALGAMATION_PREPROCESSED=${LR11XX_RF_API_AMALGAMATION_PREPROCESSED} -DLR11XX_RF_API_AMALGAMATION_SOURCE=${LR11XX_RF_API_AMALGAMATION_SOURCE} -DLR11XX_DRIVER_SOURCE_DIR=${LR11XX_DRIVER_SOURCE_DIR} -P ${CMAKE_CURRENT_LIST_FILE}
+	COMMAND_EXPAND_LISTS
+	VERBATIM
+)
+
+add_custom_target(amalgamation_${PROJECT_NAME}
+	DEPENDS ${LR11XX_RF_API_AMALGAMATION_SOURCE}
+)
+if (NOT TARGET lr11xx_driver)
+	add_dependencies(amalgamation_${PROJECT_NAME} lr11xx)
+endif()
+
+#Target to create library from the amalgamation
+add_library(${PROJECT_NAME}_amalgamation STATIC EXCLUDE_FROM_ALL ${LR11XX_RF_API_AMALGAMATION_SOURCE} ${LR11XX_RF_API_AMALGAMATION_BOARD_SOURCES})
+add_dependencies(${PROJECT_NAME}_amalgamation amalgamation_${PROJECT_NAME})
+target_include_directories(${PROJECT_NAME}_amalgamation PUBLIC
+	$<TARGET_PROPERTY:${PROJECT_NAME}_obj,INCLUDE_DIRECTORIES>
+)
+target_compile_definitions(${PROJECT_NAME}_amalgamation PUBLIC
+	$<TARGET_PROPERTY:${PROJECT_NAME}_obj,COMPILE_DEFINITIONS>
+)
+set_target_properties(${PROJECT_NAME}_amalgamation
+    PROPERTIES
+    ARCHIVE_OUTPUT_DIRECTORY ${LIB_LOCATION}
+    LIBRARY_OUTPUT_DIRECTORY ${LIB_LOCATION}
+)
@@ -0,0 +1,143 @@
+################################################################################
+#
+# Copyright (c) 2024, UnaBiz SAS
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#  1 Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#  2 Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+#    used to endorse or promote products derived from this software without
+#    specific prior written permission.
+#
+# NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+# THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+# CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+# PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+# CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+# BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+# IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+################################################################################
+
+#Load the board descriptor (LR11XX_BOARD_* variables)
+if (NOT EXISTS ${LR11XX_BOARD_DESCRIPTOR})
+    message(FATAL_ERROR "Board descriptor ${LR11XX_BOARD_DESCRIPTOR} not found")
+endif()
+include(${LR11XX_BOARD_DESCRIPTOR})
+set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${LR11XX_BOARD_DESCRIPTOR})
+
+#PA tables per frequency band: "<band>:<minimum frequency (Hz)>:<maximum frequency (Hz)>", with one LR11XX_BOARD_PA_PWR_TABLE_<band> table per band.
+#Without LR11XX_BOARD_PA_BANDS, a single table (LR11XX_BOARD_PA_PWR_TABLE) is used for all the frequencies.
+if (NOT DEFINED LR11XX_BOARD_PA_BANDS)
+    if (NOT DEFINED LR11XX_BOARD_PA_BAND)
+        set(LR11XX_BOARD_PA_BAND DEFAULT)
+    endif()
+    set(LR11XX_BOARD_PA_BANDS "${LR11XX_BOARD_PA_BAND}:0:4294967295")
+    if (DEFINED LR11XX_BOARD_PA_PWR_TABLE)
+        set(LR11XX_BOARD_PA_PWR_TABLE_${LR11XX_BOARD_PA_BAND} ${LR11XX_BOARD_PA_PWR_TABLE})
+    endif()
+endif()
+
+#PA tables can be generated by the optimizer from the target output powers
+if (DEFINED LR11XX_BOARD_PA_PWR_TARGETS)
+    if (DEFINED LR11XX_BOARD_PA_CALIBRATION)
+        set(LR11XX_PA_CALIBRATION ${LR11XX_BOARD_PA_CALIBRATION})
+    endif()
+    include(optimize_lr11xx_pa_table)
+    foreach(X IN LISTS LR11XX_BOARD_PA_BANDS)
+        string(REPLACE ":" ";" FIELDS ${X})
+        list(GET FIELDS 0 PA_BAND)
+        if (NOT DEFINED LR11XX_BOARD_PA_PWR_TABLE_${PA_BAND})
+            lr11xx_optimize_pa_table(${PA_BAND} "${LR11XX_BOARD_PA_PWR_TARGETS}" LR11XX_BOARD_PA_PWR_TABLE_${PA_BAND})
+            foreach(Y IN LISTS LR11XX_BOARD_PA_PWR_TABLE_${PA_BAND}_REPORT)
+                message(STATUS "LR11XX PA table ${PA_BAND}: ${Y}")
+            endforeach()
+        endif()
+    endforeach()
+endif()
+
+#Check mandatory settings
+foreach(X IN ITEMS LR11XX_BOARD_FEM_PIN_USED LR11XX_BOARD_FEM_STBY LR11XX_BOARD_FEM_RX LR11XX_BOARD_FEM_TX LR11XX_BOARD_FEM_TXHP LR11XX_BOARD_FEM_WIFI LR11XX_BOARD_FEM_GNSS)
+    if (NOT DEFINED ${X})
+        message(FATAL_ERROR "${X} is not defined in board descriptor ${LR11XX_BOARD_DESCRIPTOR}")
+    endif()
+endforeach()
+
+#Optional settings
+if (DEFINED LR11XX_BOARD_TCXO_SUPPLY_VOLTAGE)
+    set(LR11XX_BOARD_XOSC_HAS_TCXO 1)
+    set(LR11XX_BOARD_XOSC_TCXO_SUPPLY_VOLTAGE LR11XX_HW_API_TCXO_CTRL_${LR11XX_BOARD_TCXO_SUPPLY_VOLTAGE})
+else()
+    set(LR11XX_BOARD_XOSC_HAS_TCXO 0)
+    set(LR11XX_BOARD_XOSC_TCXO_SUPPLY_VOLTAGE LR11XX_HW_API_TCXO_CTRL_1_6V)
+endif()
+if (NOT DEFINED LR11XX_BOARD_TCXO_STARTUP_TIME_IN_TICK)
+    set(LR11XX_BOARD_TCXO_STARTUP_TIME_IN_TICK 0)
+endif()
+if (NOT DEFINED LR11XX_BOARD_LATENCY_RESET_MS)
+    set(LR11XX_BOARD_LATENCY_RESET_MS 0)
+endif()
+if (NOT DEFINED LR11XX_BOARD_LATENCY_WAKEUP_MS)
+    set(LR11XX_BOARD_LATENCY_WAKEUP_MS 0)
+endif()
+if (NOT DEFINED LR11XX_BOARD_REG_MODE_HAS_DCDC)
+    set(LR11XX_BOARD_REG_MODE_HAS_DCDC 0)
+endif()
+if (NOT DEFINED LR11XX_BOARD_REG_MODE_RX_DCDC)
+    set(LR11XX_BOARD_REG_MODE_RX_DCDC 0)
+endif()
+
+#PA tables: one "<dBm>:<power>:<LP|HP|HF>:<VREG|VBAT>:<duty cycle>:<HP slices>" entry per output power.
+#The entries of all the bands are generated in a single table, each band gives the range of its own entries.
+set(LR11XX_BOARD_PA_PWR_TABLE_ENTRIES "")
+set(LR11XX_BOARD_PA_PWR_BANDS_ENTRIES "")
+set(PA_FIRST_ENTRY 0)
+foreach(X IN LISTS LR11XX_BOARD_PA_BANDS)
+    string(REPLACE ":" ";" FIELDS ${X})
+    list(LENGTH FIELDS FIELDS_COUNT)
+    if (NOT FIELDS_COUNT EQUAL 3)
+        message(FATAL_ERROR "Invalid PA band ${X} in board descriptor ${LR11XX_BOARD_DESCRIPTOR}")
+    endif()
+    list(GET FIELDS 0 PA_BAND)
+    list(GET FIELDS 1 PA_MIN_FREQ_HZ)
+    list(GET FIELDS 2 PA_MAX_FREQ_HZ)
+    if (NOT DEFINED LR11XX_BOARD_PA_PWR_TABLE_${PA_BAND})
+        message(FATAL_ERROR "LR11XX_BOARD_PA_PWR_TABLE_${PA_BAND} is not defined in board descriptor ${LR11XX_BOARD_DESCRIPTOR}")
+    endif()
+    list(LENGTH LR11XX_BOARD_PA_PWR_TABLE_${PA_BAND} PA_ENTRY_COUNT)
+    foreach(Y IN LISTS LR11XX_BOARD_PA_PWR_TABLE_${PA_BAND})
+        string(REPLACE ":" ";" FIELDS ${Y})
+        list(LENGTH FIELDS FIELDS_COUNT)
+        if (NOT FIELDS_COUNT EQUAL 6)
+            message(FATAL_ERROR "Invalid PA table entry ${Y} of band ${PA_BAND} in board descriptor ${LR11XX_BOARD_DESCRIPTOR}")
+        endif()
+        list(GET FIELDS 0 PA_DBM)
+        list(GET FIELDS 1 PA_POWER)
+        list(GET FIELDS 2 PA_SEL)
+        list(GET FIELDS 3 PA_SUPPLY)
+        list(GET FIELDS 4 PA_DUTY_CYCLE)
+        list(GET FIELDS 5 PA_HP_SEL)
+        string(APPEND LR11XX_BOARD_PA_PWR_TABLE_ENTRIES " \\\n    { ${PA_DBM}, { ${PA_POWER}, { LR11XX_HW_API_RADIO_PA_SEL_${PA_SEL}, LR11XX_HW_API_RADIO_PA_REG_SUPPLY_${PA_SUPPLY}, ${PA_DUTY_CYCLE}, ${PA_HP_SEL} } } },")
+    endforeach()
+    string(APPEND LR11XX_BOARD_PA_PWR_BANDS_ENTRIES " \\\n    { ${PA_MIN_FREQ_HZ}, ${PA_MAX_FREQ_HZ}, ${PA_FIRST_ENTRY}, ${PA_ENTRY_COUNT} }, /* ${PA_BAND} */")
+    math(EXPR PA_FIRST_ENTRY "${PA_FIRST_ENTRY} + ${PA_ENTRY_COUNT}")
+endforeach()
+if (PA_FIRST_ENTRY GREATER 255)
+    message(FATAL_ERROR "Too many PA table entries (${PA_FIRST_ENTRY}) in board descriptor ${LR11XX_BOARD_DESCRIPTOR}")
+endif()
+
+#Generate the board configuration header
+set(LR11XX_BOARD_CONFIG_DIR ${CMAKE_CURRENT_BINARY_DIR}/board_config)
+configure_file(${CMAKE_CURRENT_LIST_DIR}/lr11xx_board_config.h.in ${LR11XX_BOARD_CONFIG_DIR}/lr11xx_board_config.h @ONLY)
+message(STATUS "LR11XX static board configuration generated from ${LR11XX_BOARD_DESCRIPTOR}")
@@ -0,0 +1,152 @@
+################################################################################
+#
+# Copyright (c) 2024, UnaBiz SAS
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#  1 Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#  2 Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+#    used to endorse or promote products derived from this software without
+#    specific prior written permission.
+#
+# NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+# THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+# CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+# PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+# CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+# BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+# IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+################################################################################
+
+# Decode a dump of the LR11XX RF API flight recorder ring (LR11XX_RF_API_flight_recorder_t).
+# The dump is the raw memory image of the structure written by a little endian target.
+# Usage: cmake -DFLIGHT_RECORDER_DUMP=<dump.bin> -P cmake/decode_lr11xx_flight_recorder.cmake
+
+cmake_minimum_required(VERSION 3.15)
+
+if (NOT DEFINED FLIGHT_RECORDER_DUMP)
+    message(FATAL_ERROR "FLIGHT_RECORDER_DUMP must be set to the path of the flight recorder dump")
+endif()
+
+set(FLIGHT_RECORDER_MAGIC 1280460370) # 0x4C524652.
+set(FLIGHT_RECORDER_HEADER_SIZE 12)
+set(FLIGHT_RECORDER_RECORD_SIZE 8)
+# Must match LR11XX_RF_API_flight_event_t and LR11XX_RF_API_function_t.
+set(FLIGHT_RECORDER_EVENTS NONE ENTRY EXIT FREQUENCY MODULATION PA_CONFIG IRQ CHIP_ERRORS)
+set(FLIGHT_RECORDER_FUNCTIONS OPEN CLOSE PROCESS WAKE_UP SLEEP INIT DE_INIT SEND RECEIVE GET_DL_PHY_CONTENT_AND_RSSI START_CONTINUOUS_WAVE ERROR OTHER)
+
+# Read a little endian unsigned integer of <size> bytes at <offset> of the dump.
+function(_flight_recorder_read_uint offset size result)
+    set(value 0)
+    set(idx ${size})
+    while (idx GREATER 0)
+        math(EXPR idx "${idx} - 1")
+        math(EXPR char_offset "(${offset} + ${idx}) * 2")
+        string(SUBSTRING "${dump}" ${char_offset} 2 byte)
+        math(EXPR value "(${value} << 8) | 0x${byte}")
+    endwhile()
+    set(${result} ${value} PARENT_SCOPE)
+endfunction()
+
+file(READ "${FLIGHT_RECORDER_DUMP}" dump HEX)
+string(LENGTH "${dump}" dump_size)
+math(EXPR dump_size "${dump_size} / 2")
+if (dump_size LESS FLIGHT_RECORDER_HEADER_SIZE)
+    message(FATAL_ERROR "Flight recorder dump is too short")
+endif()
+_flight_recorder_read_uint(0 4 magic)
+_flight_recorder_read_uint(4 2 index)
+_flight_recorder_read_uint(6 2 size)
+if (NOT magic EQUAL FLIGHT_RECORDER_MAGIC)
+    message(FATAL_ERROR "Invalid flight recorder magic")
+endif()
+math(EXPR expected_size "${FLIGHT_RECORDER_HEADER_SIZE} + (${size} * ${FLIGHT_RECORDER_RECORD_SIZE})")
+if ((dump_size LESS expected_size) OR (NOT index LESS size))
+    message(FATAL_ERROR "Flight recorder dump does not match its header")
+endif()
+
+# Records are printed from the oldest one, with a time relative to it.
+set(time_us 0)
+set(first_record TRUE)
+set(count 0)
+while (count LESS size)
+    math(EXPR record_index "(${index} + ${count}) % ${size}")
+    math(EXPR offset "${FLIGHT_RECORDER_HEADER_SIZE} + (${record_index} * ${FLIGHT_RECORDER_RECORD_SIZE})")
+    math(EXPR count "${count} + 1")
+    _flight_recorder_read_uint(${offset} 1 event)
+    if (event EQUAL 0)
+        continue()
+    endif()
+    math(EXPR offset_arg8 "${offset} + 1")
+    math(EXPR offset_delta "${offset} + 2")
+    math(EXPR offset_arg32 "${offset} + 4")
+    _flight_recorder_read_uint(${offset_arg8} 1 arg8)
+    _flight_recorder_read_uint(${offset_delta} 2 delta)
+    _flight_recorder_read_uint(${offset_arg32} 4 arg32)
+    if (delta GREATER_EQUAL 32768)
+        math(EXPR delta "(${delta} & 0x7FFF) << 10")
+    endif()
+    if (first_record)
+        set(first_record FALSE)
+    else()
+        math(EXPR time_us "${time_us} + ${delta}")
+    endif()
+    list(LENGTH FLIGHT_RECORDER_EVENTS event_count)
+    if (event LESS event_count)
+        list(GET FLIGHT_RECORDER_EVENTS ${event} event_name)
+    else()
+        set(event_name "EVENT_${event}")
+    endif()
+    math(EXPR arg32_hex "${arg32}" OUTPUT_FORMAT HEXADECIMAL)
+    if ((event_name STREQUAL "ENTRY") OR (event_name STREQUAL "EXIT"))
+        list(LENGTH FLIGHT_RECORDER_FUNCTIONS function_count)
+        if (arg8 LESS function_count)
+            list(GET FLIGHT_RECORDER_FUNCTIONS ${arg8} function_name)
+        else()
+            set(function_name "FUNCTION_${arg8}")
+        endif()
+        if (event_name STREQUAL "EXIT")
+            set(details "${function_name} status=${arg32_hex}")
+        else()
+            set(details "${function_name}")
+        endif()
+    elseif (event_name STREQUAL "FREQUENCY")
+        set(details "${arg32} Hz")
+    elseif (event_name STREQUAL "MODULATION")
+        math(EXPR rf_mode "${arg8} >> 4")
+        math(EXPR modulation "${arg8} & 0x0F")
+        set(details "rf_mode=${rf_mode} modulation=${modulation} ${arg32} bps")
+    elseif (event_name STREQUAL "PA_CONFIG")
+        if (arg8 GREATER_EQUAL 128)
+            math(EXPR arg8 "${arg8} - 256")
+        endif()
+        math(EXPR power "${arg32} & 0xFF")
+        if (power GREATER_EQUAL 128)
+            math(EXPR power "${power} - 256")
+        endif()
+        math(EXPR pa_sel "(${arg32} >> 8) & 0x0F")
+        math(EXPR pa_reg_supply "(${arg32} >> 12) & 0x0F")
+        math(EXPR pa_duty_cycle "(${arg32} >> 16) & 0xFF")
+        math(EXPR pa_hp_sel "(${arg32} >> 24) & 0xFF")
+        set(details "${arg8} dBm power=${power} pa_sel=${pa_sel} pa_reg_supply=${pa_reg_supply} pa_duty_cycle=${pa_duty_cycle} pa_hp_sel=${pa_hp_sel}")
+    elseif (event_name STREQUAL "IRQ")
+        set(details "mask=${arg32_hex}")
+    elseif (event_name STREQUAL "CHIP_ERRORS")
+        set(details "status=${arg8} errors=${arg32_hex}")
+    else()
+        set(details "arg8=${arg8} arg32=${arg32_hex}")
+    endif()
+    message("${time_us} us ${event_name} ${details}")
+endwhile()
@@ -0,0 +1,81 @@
+################################################################################
+#
+# Copyright (c) 2024, UnaBiz SAS
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#  1 Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#  2 Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+#    used to endorse or promote products derived from this software without
+#    specific prior written permission.
+#
+# NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+# THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+# CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+# PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+# CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+# BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+# IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+################################################################################
+
+# Example of LR11XX board descriptor (LR1110 with TCXO, RF switch on DIO5 to DIO7).
+# Use it with: cmake -DLR11XX_BOARD_DESCRIPTOR=<descriptor path> ..
+
+# RF switch DIO masks (combination of DIO5 = 0x01, DIO6 = 0x02, DIO7 = 0x04, DIO8 = 0x08, DIO10 = 0x10).
+set(LR11XX_BOARD_FEM_PIN_USED 0x07)
+set(LR11XX_BOARD_FEM_STBY 0x00)
+set(LR11XX_BOARD_FEM_RX 0x01)
+set(LR11XX_BOARD_FEM_TX 0x03)
+set(LR11XX_BOARD_FEM_TXHP 0x02)
+set(LR11XX_BOARD_FEM_WIFI 0x00)
+set(LR11XX_BOARD_FEM_GNSS 0x04)
+
+# TCXO supply voltage (1_6V, 1_7V, 1_8V, 2_2V, 2_4V, 2_7V, 3_0V or 3_3V) and startup time in 30.52 us ticks.
+# Remove these lines if the board uses a crystal.
+set(LR11XX_BOARD_TCXO_SUPPLY_VOLTAGE 1_8V)
+set(LR11XX_BOARD_TCXO_STARTUP_TIME_IN_TICK 300)
+
+# Hardware latencies in ms (only used with SIGFOX_EP_LATENCY_COMPENSATION).
+set(LR11XX_BOARD_LATENCY_RESET_MS 0)
+set(LR11XX_BOARD_LATENCY_WAKEUP_MS 0)
+
+# Regulator (only used with LR11XX_RF_API_REG_MODE_POLICY): DC-DC inductor fitted, and DC-DC allowed during the downlink window
+# (set to 0 if sensitivity measurements show a penalty with the DC-DC).
+set(LR11XX_BOARD_REG_MODE_HAS_DCDC 1)
+set(LR11XX_BOARD_REG_MODE_RX_DCDC 1)
+
+# PA tables per frequency band: "<band>:<minimum frequency (Hz)>:<maximum frequency (Hz)>", the table of the band containing the TX frequency is used.
+# Each band has its own table "<dBm>:<power>:<LP|HP|HF>:<VREG|VBAT>:<duty cycle>:<HP slices>" in LR11XX_BOARD_PA_PWR_TABLE_<band>.
+# A board with a single table for all the frequencies can define LR11XX_BOARD_PA_PWR_TABLE instead.
+set(LR11XX_BOARD_PA_BANDS
+    "EU868:862000000:876000000"
+    "US915:902000000:928000000"
+)
+set(LR11XX_BOARD_PA_PWR_TABLE_EU868
+    "14:14:LP:VREG:0x04:0x00"
+    "16:19:HP:VBAT:0x02:0x02"
+    "22:22:HP:VBAT:0x04:0x07"
+)
+set(LR11XX_BOARD_PA_PWR_TABLE_US915
+    "14:15:LP:VREG:0x04:0x00"
+    "16:20:HP:VBAT:0x02:0x02"
+    "22:22:HP:VBAT:0x04:0x07"
+)
+
+# The PA tables can also be generated with the lowest current settings by the PA optimizer (cmake/optimize_lr11xx_pa_table.cmake),
+# for the bands whose LR11XX_BOARD_PA_PWR_TABLE_<band> is not defined. Measured points (see the optimizer for the format) refine its model.
+# The output file of the optimizer script can also be included here.
+# set(LR11XX_BOARD_PA_PWR_TARGETS 10 12 14 16 20 22)
+# set(LR11XX_BOARD_PA_CALIBRATION "EU868:14:LP:VREG:0x06:0x00:1400:24000")
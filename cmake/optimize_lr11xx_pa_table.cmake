@@ -0,0 +1,258 @@
+################################################################################
+#
+# Copyright (c) 2024, UnaBiz SAS
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#  1 Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#  2 Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+#    used to endorse or promote products derived from this software without
+#    specific prior written permission.
+#
+# NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+# THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+# CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+# PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+# CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+# BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+# IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+################################################################################
+
+
+# LR11XX PA table optimizer.
+# Search the PA settings (PA, supply, duty cycle, HP slices and power register) giving the lowest battery current
+# for each target output power, and return entries in the board descriptor PA table format.
+# Script usage: cmake -DLR11XX_PA_TARGETS="<dBm list>" [-DLR11XX_PA_BANDS="<band list>"] [-DLR11XX_PA_CALIBRATION_FILE=<file>]
+#               [-DLR11XX_PA_OUTPUT=<file>] -P cmake/optimize_lr11xx_pa_table.cmake
+# The output file sets LR11XX_BOARD_PA_PWR_TABLE_<band> for each band, to be included in a board descriptor listing the same bands in LR11XX_BOARD_PA_BANDS.
+#
+# Powers are handled in 0.01 dB (cdB), currents in uA.
+# The default model is a first-order PA model tuned on the typical TX currents of the LR11XX datasheets:
+# - saturated output power of LP_PSAT_BASE + duty cycle (+ HP slices for the HP PA) dBm, limited to PSAT_MAX,
+# - output power reduced by 1 dB per power register step below POWER_MAX,
+# - drain efficiency ETA_SAT at saturation, decreasing as the output amplitude in back-off,
+# - DC-DC conversion efficiency on the VREG supply, and bias currents for the PA, the duty cycle and the HP slices.
+# Measured points (LR11XX_PA_CALIBRATION) correct the output power offset and the current scale of the model,
+# per band, PA and supply: "<band>:<power>:<LP|HP>:<VREG|VBAT>:<duty cycle>:<HP slices>:<measured output power (cdBm)>:<measured current (uA)>".
+# The HF PA (2.4GHz) is not used for Sigfox and is not searched.
+
+cmake_minimum_required(VERSION 3.15)
+
+#Model settings (can be overridden before including this file)
+foreach(X IN ITEMS
+        "LR11XX_PA_VBAT_MV;3300"
+        "LR11XX_PA_DCDC_EFFICIENCY_PERMILLE;900"
+        "LR11XX_PA_TOLERANCE_CDB;50"
+        "LR11XX_PA_SELECTION;LP|HP"
+        "LR11XX_PA_LP_SUPPLIES;VREG|VBAT"
+        "LR11XX_PA_LP_DUTY_CYCLE_MAX;7"
+        "LR11XX_PA_LP_HP_SEL_MAX;0"
+        "LR11XX_PA_LP_POWER_MIN;-17"
+        "LR11XX_PA_LP_POWER_MAX;14"
+        "LR11XX_PA_LP_PSAT_BASE_CDBM;800"
+        "LR11XX_PA_LP_PSAT_MAX_CDBM;1500"
+        "LR11XX_PA_LP_BIAS_UA;3000"
+        "LR11XX_PA_LP_VREG_ETA_SAT_PERMILLE;450"
+        "LR11XX_PA_LP_VBAT_ETA_SAT_PERMILLE;250"
+        "LR11XX_PA_HP_SUPPLIES;VBAT"
+        "LR11XX_PA_HP_DUTY_CYCLE_MAX;4"
+        "LR11XX_PA_HP_HP_SEL_MAX;7"
+        "LR11XX_PA_HP_POWER_MIN;-9"
+        "LR11XX_PA_HP_POWER_MAX;22"
+        "LR11XX_PA_HP_PSAT_BASE_CDBM;1400"
+        "LR11XX_PA_HP_PSAT_MAX_CDBM;2200"
+        "LR11XX_PA_HP_BIAS_UA;8000"
+        "LR11XX_PA_HP_VBAT_ETA_SAT_PERMILLE;450"
+        "LR11XX_PA_DUTY_CYCLE_BIAS_UA;300"
+        "LR11XX_PA_HP_SLICE_BIAS_UA;1000")
+    list(GET X 0 NAME)
+    list(GET X 1 VALUE)
+    if (NOT DEFINED ${NAME})
+        string(REPLACE "|" ";" VALUE "${VALUE}")
+        set(${NAME} "${VALUE}")
+    endif()
+endforeach()
+
+# 10^(x / 1000) * 10000 for x >= 0 (x in cdB), linearly interpolated between 1 dB steps.
+function(_lr11xx_pa_pow10 x result)
+    set(STEPS 10000 12589 15849 19953 25119 31623 39811 50119 63096 79433 100000)
+    math(EXPR DECADE "${x} / 1000")
+    math(EXPR STEP "(${x} % 1000) / 100")
+    math(EXPR STEP_NEXT "${STEP} + 1")
+    list(GET STEPS ${STEP} LOW)
+    list(GET STEPS ${STEP_NEXT} HIGH)
+    math(EXPR VALUE "${LOW} + (((${HIGH} - ${LOW}) * (${x} % 100)) / 100)")
+    while (DECADE GREATER 0)
+        math(EXPR VALUE "${VALUE} * 10")
+        math(EXPR DECADE "${DECADE} - 1")
+    endwhile()
+    set(${result} ${VALUE} PARENT_SCOPE)
+endfunction()
+
+# Model of a PA setting: saturated output power (cdBm), output power (cdBm) and battery current (uA), without calibration.
+function(_lr11xx_pa_model pa supply duty_cycle hp_sel power psat_result output_result current_result)
+    math(EXPR PSAT "${LR11XX_PA_${pa}_PSAT_BASE_CDBM} + ((${duty_cycle} + ${hp_sel}) * 100)")
+    if (PSAT GREATER LR11XX_PA_${pa}_PSAT_MAX_CDBM)
+        set(PSAT ${LR11XX_PA_${pa}_PSAT_MAX_CDBM})
+    endif()
+    math(EXPR BACKOFF "(${LR11XX_PA_${pa}_POWER_MAX} - ${power}) * 100")
+    math(EXPR OUTPUT "${PSAT} - ${BACKOFF}")
+    # RF power in uW (0 dBm = 1000 uW = 30 dB above 1 uW).
+    math(EXPR X "${OUTPUT} + 3000")
+    if (X LESS 0)
+        set(X 0)
+    endif()
+    _lr11xx_pa_pow10(${X} RF_POWER)
+    math(EXPR RF_POWER "${RF_POWER} / 10000")
+    # Efficiency decreases as the output amplitude.
+    math(EXPR X "${BACKOFF} / 2")
+    _lr11xx_pa_pow10(${X} AMPLITUDE)
+    math(EXPR ETA "(${LR11XX_PA_${pa}_${supply}_ETA_SAT_PERMILLE} * 10000) / ${AMPLITUDE}")
+    if (ETA LESS 1)
+        set(ETA 1)
+    endif()
+    math(EXPR CURRENT "((${RF_POWER} * 1000 / ${ETA}) * 1000) / ${LR11XX_PA_VBAT_MV}")
+    if (supply STREQUAL "VREG")
+        math(EXPR CURRENT "(${CURRENT} * 1000) / ${LR11XX_PA_DCDC_EFFICIENCY_PERMILLE}")
+    endif()
+    math(EXPR CURRENT "${CURRENT} + ${LR11XX_PA_${pa}_BIAS_UA} + (${duty_cycle} * ${LR11XX_PA_DUTY_CYCLE_BIAS_UA}) + (${hp_sel} * ${LR11XX_PA_HP_SLICE_BIAS_UA})")
+    set(${psat_result} ${PSAT} PARENT_SCOPE)
+    set(${output_result} ${OUTPUT} PARENT_SCOPE)
+    set(${current_result} ${CURRENT} PARENT_SCOPE)
+endfunction()
+
+# Compute the calibration of a band, PA and supply: output power offset (cdB) and current scale (permille).
+function(_lr11xx_pa_calibration band pa supply offset_result scale_result)
+    set(COUNT 0)
+    set(OFFSET 0)
+    set(SCALE 0)
+    foreach(X IN LISTS LR11XX_PA_CALIBRATION)
+        string(REPLACE ":" ";" FIELDS ${X})
+        list(LENGTH FIELDS FIELDS_COUNT)
+        if (NOT FIELDS_COUNT EQUAL 8)
+            message(FATAL_ERROR "Invalid PA calibration point ${X}")
+        endif()
+        list(GET FIELDS 0 CAL_BAND)
+        list(GET FIELDS 2 CAL_PA)
+        list(GET FIELDS 3 CAL_SUPPLY)
+        if ((CAL_BAND STREQUAL band) AND (CAL_PA STREQUAL pa) AND (CAL_SUPPLY STREQUAL supply))
+            list(GET FIELDS 1 CAL_POWER)
+            list(GET FIELDS 4 CAL_DUTY_CYCLE)
+            list(GET FIELDS 5 CAL_HP_SEL)
+            list(GET FIELDS 6 CAL_OUTPUT)
+            list(GET FIELDS 7 CAL_CURRENT)
+            math(EXPR CAL_DUTY_CYCLE "${CAL_DUTY_CYCLE}")
+            math(EXPR CAL_HP_SEL "${CAL_HP_SEL}")
+            _lr11xx_pa_model(${pa} ${supply} ${CAL_DUTY_CYCLE} ${CAL_HP_SEL} ${CAL_POWER} PSAT OUTPUT CURRENT)
+            math(EXPR OFFSET "${OFFSET} + ${CAL_OUTPUT} - ${OUTPUT}")
+            math(EXPR SCALE "${SCALE} + ((${CAL_CURRENT} * 1000) / ${CURRENT})")
+            math(EXPR COUNT "${COUNT} + 1")
+        endif()
+    endforeach()
+    if (COUNT EQUAL 0)
+        set(${offset_result} 0 PARENT_SCOPE)
+        set(${scale_result} 1000 PARENT_SCOPE)
+    else()
+        math(EXPR OFFSET "${OFFSET} / ${COUNT}")
+        math(EXPR SCALE "${SCALE} / ${COUNT}")
+        set(${offset_result} ${OFFSET} PARENT_SCOPE)
+        set(${scale_result} ${SCALE} PARENT_SCOPE)
+    endif()
+endfunction()
+
+# Optimize the PA table of a band for a list of target output powers (dBm).
+# <result> is set to the board descriptor PA table entries, and <result>_REPORT to one line per entry with the model figures.
+function(lr11xx_optimize_pa_table band targets result)
+    foreach(TARGET IN LISTS targets)
+        set(BEST_${TARGET}_CURRENT -1)
+    endforeach()
+    foreach(PA IN LISTS LR11XX_PA_SELECTION)
+        foreach(SUPPLY IN LISTS LR11XX_PA_${PA}_SUPPLIES)
+            _lr11xx_pa_calibration(${band} ${PA} ${SUPPLY} OFFSET SCALE)
+            set(DUTY_CYCLE 0)
+            while (NOT DUTY_CYCLE GREATER LR11XX_PA_${PA}_DUTY_CYCLE_MAX)
+                set(HP_SEL 0)
+                while (NOT HP_SEL GREATER LR11XX_PA_${PA}_HP_SEL_MAX)
+                    _lr11xx_pa_model(${PA} ${SUPPLY} ${DUTY_CYCLE} ${HP_SEL} ${LR11XX_PA_${PA}_POWER_MAX} PSAT OUTPUT CURRENT)
+                    foreach(TARGET IN LISTS targets)
+                        # Power register giving the closest output power.
+                        math(EXPR POWER "${LR11XX_PA_${PA}_POWER_MAX} - ((${PSAT} + ${OFFSET} - (${TARGET} * 100) + 50) / 100)")
+                        if ((POWER LESS LR11XX_PA_${PA}_POWER_MIN) OR (POWER GREATER LR11XX_PA_${PA}_POWER_MAX))
+                            continue()
+                        endif()
+                        _lr11xx_pa_model(${PA} ${SUPPLY} ${DUTY_CYCLE} ${HP_SEL} ${POWER} PSAT_UNUSED OUTPUT CURRENT)
+                        math(EXPR OUTPUT "${OUTPUT} + ${OFFSET}")
+                        math(EXPR CURRENT "(${CURRENT} * ${SCALE}) / 1000")
+                        math(EXPR ERROR "${OUTPUT} - (${TARGET} * 100)")
+                        if (ERROR LESS 0)
+                            math(EXPR ERROR "-${ERROR}")
+                        endif()
+                        if (ERROR GREATER LR11XX_PA_TOLERANCE_CDB)
+                            continue()
+                        endif()
+                        if ((BEST_${TARGET}_CURRENT LESS 0) OR (CURRENT LESS BEST_${TARGET}_CURRENT) OR ((CURRENT EQUAL BEST_${TARGET}_CURRENT) AND (ERROR LESS BEST_${TARGET}_ERROR)))
+                            set(BEST_${TARGET}_CURRENT ${CURRENT})
+                            set(BEST_${TARGET}_ERROR ${ERROR})
+                            set(BEST_${TARGET}_OUTPUT ${OUTPUT})
+                            set(BEST_${TARGET}_ENTRY "${TARGET}:${POWER}:${PA}:${SUPPLY}:0x0${DUTY_CYCLE}:0x0${HP_SEL}")
+                        endif()
+                    endforeach()
+                    math(EXPR HP_SEL "${HP_SEL} + 1")
+                endwhile()
+                math(EXPR DUTY_CYCLE "${DUTY_CYCLE} + 1")
+            endwhile()
+        endforeach()
+    endforeach()
+    set(ENTRIES "")
+    set(REPORT "")
+    foreach(TARGET IN LISTS targets)
+        if (BEST_${TARGET}_CURRENT LESS 0)
+            message(FATAL_ERROR "No PA setting found for ${TARGET} dBm in band ${band}")
+        endif()
+        list(APPEND ENTRIES "${BEST_${TARGET}_ENTRY}")
+        list(APPEND REPORT "${BEST_${TARGET}_ENTRY} -> ${BEST_${TARGET}_OUTPUT} cdBm ${BEST_${TARGET}_CURRENT} uA")
+    endforeach()
+    set(${result} "${ENTRIES}" PARENT_SCOPE)
+    set(${result}_REPORT "${REPORT}" PARENT_SCOPE)
+endfunction()
+
+#Script mode
+if (CMAKE_SCRIPT_MODE_FILE STREQUAL CMAKE_CURRENT_LIST_FILE)
+    if (NOT DEFINED LR11XX_PA_TARGETS)
+        message(FATAL_ERROR "LR11XX_PA_TARGETS must be set to the list of target output powers (dBm)")
+    endif()
+    if (NOT DEFINED LR11XX_PA_BANDS)
+        set(LR11XX_PA_BANDS DEFAULT)
+    endif()
+    if (DEFINED LR11XX_PA_CALIBRATION_FILE)
+        include(${LR11XX_PA_CALIBRATION_FILE})
+    endif()
+    set(OUTPUT_CONTENT "# Generated by optimize_lr11xx_pa_table.cmake.\n")
+    foreach(BAND IN LISTS LR11XX_PA_BANDS)
+        lr11xx_optimize_pa_table(${BAND} "${LR11XX_PA_TARGETS}" PA_PWR_TABLE)
+        message("Band ${BAND}:")
+        string(APPEND OUTPUT_CONTENT "set(LR11XX_BOARD_PA_PWR_TABLE_${BAND}\n")
+        foreach(X IN LISTS PA_PWR_TABLE_REPORT)
+            message("    ${X}")
+        endforeach()
+        foreach(X IN LISTS PA_PWR_TABLE)
+            string(APPEND OUTPUT_CONTENT "    \"${X}\"\n")
+        endforeach()
+        string(APPEND OUTPUT_CONTENT ")\n")
+    endforeach()
+    if (DEFINED LR11XX_PA_OUTPUT)
+        file(WRITE ${LR11XX_PA_OUTPUT} "${OUTPUT_CONTENT}")
+    endif()
+endif()
@@ -129,6 +129,28 @@ typedef struct {
     sfx_u32 startup_time_in_tick;
 } LR11XX_HW_API_xosc_cfg_t;
 
+#ifdef LR11XX_RF_API_POWER_POLICY
+/*!******************************************************************
+ * \struct LR11XX_HW_API_power_timings_t
+ * \brief LR11XX measured exit times of the low power modes.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 xosc_startup_time_us; // From RC standby to XOSC standby (TCXO or crystal startup).
+    sfx_u32 warm_wake_up_time_us; // From sleep with retention to XOSC standby, including the oscillator startup.
+} LR11XX_HW_API_power_timings_t;
+#endif
+
+#ifdef LR11XX_RF_API_REG_MODE_POLICY
+/*!******************************************************************
+ * \struct LR11XX_HW_API_reg_mode_cfg_t
+ * \brief LR11XX regulator capabilities of the board.
+ *******************************************************************/
+typedef struct {
+    sfx_u8 has_dcdc; // DC-DC inductor fitted.
+    sfx_u8 rx_dcdc; // DC-DC allowed during the downlink window (no sensitivity penalty measured on the board).
+} LR11XX_HW_API_reg_mode_cfg_t;
+#endif
+
 /*!******************************************************************
  * \struct LR11XX_HW_API_pa_cfg_t
  * \brief Configuration of Power Amplifier
@@ -149,6 +171,28 @@ typedef struct {
     LR11XX_HW_API_pa_cfg_t pa_config;
 } LR11XX_HW_API_pa_pwr_cfg_t;
 
+#ifdef LR11XX_HW_API_STATIC_CONFIG
+/*!******************************************************************
+ * \struct LR11XX_HW_API_pa_pwr_table_entry_t
+ * \brief PA power configuration of the static board descriptor for a given output power.
+ *******************************************************************/
+typedef struct {
+    sfx_s8 expected_output_pwr_in_dbm;
+    LR11XX_HW_API_pa_pwr_cfg_t pa_pwr_cfg;
+} LR11XX_HW_API_pa_pwr_table_entry_t;
+
+/*!******************************************************************
+ * \struct LR11XX_HW_API_pa_pwr_band_t
+ * \brief Frequency range of the static board descriptor with its own PA table entries.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 min_freq_hz;
+    sfx_u32 max_freq_hz;
+    sfx_u8 first_entry;
+    sfx_u8 entry_count;
+} LR11XX_HW_API_pa_pwr_band_t;
+#endif
+
 #if (defined SIGFOX_EP_TIMER_REQUIRED) && (defined SIGFOX_EP_LATENCY_COMPENSATION)
 /*!******************************************************************
  * \enum LR11XX_HW_API_latency_t
@@ -174,6 +218,9 @@ typedef void (*LR11XX_HW_API_irq_cb_t)(void);
 typedef struct {
     const SIGFOX_rc_t *rc;
     LR11XX_HW_API_irq_cb_t gpio_irq_callback;
+#if ((defined LR11XX_RF_API_SWEEP) || (defined LR11XX_RF_API_SPECTRUM_SCAN)) && (defined SIGFOX_EP_ASYNCHRONOUS)
+    LR11XX_HW_API_irq_cb_t timer_irq_callback;
+#endif
 } LR11XX_HW_API_config_t;
 
 /*** LR11XX HW API functions ***/
@@ -209,6 +256,83 @@ LR11XX_HW_API_status_t LR11XX_HW_API_close(void);
  *******************************************************************/
 LR11XX_HW_API_status_t LR11XX_HW_API_delayMs(unsigned short delay_ms);
 
+#ifdef LR11XX_RF_API_SHARED_BUS
+/*!******************************************************************
+ * \fn LR11XX_HW_API_status_t LR11XX_HW_API_bus_acquire(void);
+ * \brief Take the SPI bus shared with other devices. This function is called before each group of LR11XX commands.
+ * \brief The bus is never held across LR11XX_HW_API_delayMs() calls or IRQ waits.
+ * \param[in]  	none
+ * \param[out] 	none
+ * \retval		Function execution status.
+ *******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_bus_acquire(void);
+#endif
+
+#ifdef LR11XX_RF_API_SHARED_BUS
+/*!******************************************************************
+ * \fn LR11XX_HW_API_status_t LR11XX_HW_API_bus_release(void);
+ * \brief Give the SPI bus back to the other devices. This function is also called on error exit paths.
+ * \param[in]  	none
+ * \param[out] 	none
+ * \retval		Function execution status.
+ *******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_bus_release(void);
+#endif
+
+#if (defined LR11XX_RF_API_SHARED_BUS) || (defined LR11XX_RF_API_FLIGHT_RECORDER)
+/*!******************************************************************
+ * \fn LR11XX_HW_API_status_t LR11XX_HW_API_get_timestamp_us(sfx_u32 *timestamp_us);
+ * \brief Read a free running microsecond counter, used to measure the bus hold time and to timestamp the flight recorder events. Wrapping around is allowed.
+ * \param[in]  	none
+ * \param[out] 	timestamp_us: Pointer to integer that will contain the current timestamp in microseconds.
+ * \retval		Function execution status.
+ *******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_get_timestamp_us(sfx_u32 *timestamp_us);
+#endif
+
+#ifdef LR11XX_RF_API_HAL_TX_BUFFER
+/*!******************************************************************
+ * \fn LR11XX_HW_API_status_t LR11XX_HW_API_get_tx_buffer(sfx_u8 **tx_buffer, sfx_u8 tx_buffer_size_bytes);
+ * \brief Get the payload stage of the SPI transfer buffer owned by the HAL (typically the DMA buffer), where the uplink frame is directly encoded. The next lr11xx_hal_write() call (LR11XX_HW_API_write_async() with the LR11XX_RF_API_ASYNC_HAL flag) is made with cdata pointing to this buffer, which can then be sent without copy.
+ * \param[in]  	tx_buffer_size_bytes: Number of bytes which will be written in the buffer.
+ * \param[out] 	tx_buffer: Pointer that will contain the address of the payload stage.
+ * \retval		Function execution status.
+ *******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_get_tx_buffer(sfx_u8 **tx_buffer, sfx_u8 tx_buffer_size_bytes);
+#endif
+
+#ifdef LR11XX_RF_API_ASYNC_HAL
+/*!******************************************************************
+ * \fn LR11XX_HW_API_status_t LR11XX_HW_API_write_async(const sfx_u8 *cbuffer, sfx_u16 cbuffer_length, const sfx_u8 *cdata, sfx_u16 cdata_length, LR11XX_HW_API_irq_cb_t cplt_cb);
+ * \brief Start the same transfer as lr11xx_hal_write() (BUSY wait, command and data phases) without waiting for its end, typically with a DMA.
+ * \brief The buffers remain valid until the end of the transfer. The cplt_cb function must be called when the transfer is completed and BUSY is low again.
+ * \param[in]  	cbuffer: Command buffer.
+ * \param[in]  	cbuffer_length: Command buffer size in bytes.
+ * \param[in]  	cdata: Data buffer.
+ * \param[in]  	cdata_length: Data buffer size in bytes.
+ * \param[in]  	cplt_cb: Function to call at the end of the transfer.
+ * \param[out] 	none
+ * \retval		Function execution status.
+ *******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_write_async(const sfx_u8 *cbuffer, sfx_u16 cbuffer_length, const sfx_u8 *cdata, sfx_u16 cdata_length, LR11XX_HW_API_irq_cb_t cplt_cb);
+#endif
+
+#if (defined LR11XX_RF_API_ASYNC_HAL) && (defined SIGFOX_EP_BIDIRECTIONAL)
+/*!******************************************************************
+ * \fn LR11XX_HW_API_status_t LR11XX_HW_API_read_async(const sfx_u8 *cbuffer, sfx_u16 cbuffer_length, sfx_u8 *rbuffer, sfx_u16 rbuffer_length, LR11XX_HW_API_irq_cb_t cplt_cb);
+ * \brief Start the same transfer as lr11xx_hal_read() (command phase, BUSY wait and read phase) without waiting for its end, typically with a DMA.
+ * \brief The buffers remain valid until the end of the transfer. The cplt_cb function must be called when rbuffer has been filled.
+ * \param[in]  	cbuffer: Command buffer.
+ * \param[in]  	cbuffer_length: Command buffer size in bytes.
+ * \param[in]  	rbuffer_length: Number of bytes to read.
+ * \param[in]  	cplt_cb: Function to call at the end of the transfer.
+ * \param[out] 	rbuffer: Buffer that will contain the read bytes.
+ * \retval		Function execution status.
+ *******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_read_async(const sfx_u8 *cbuffer, sfx_u16 cbuffer_length, sfx_u8 *rbuffer, sfx_u16 rbuffer_length, LR11XX_HW_API_irq_cb_t cplt_cb);
+#endif
+
+#ifndef LR11XX_HW_API_STATIC_CONFIG
 /*!******************************************************************
 
  * \fn LR11XX_HW_API_status_t LR11XX_HW_API_get_fem_mask(LR11XX_HW_API_FEM_t fem, sfx_u8 *rfsw_dio_mask);
@@ -241,6 +365,86 @@ LR11XX_HW_API_status_t LR11XX_HW_API_get_xosc_cfg(LR11XX_HW_API_xosc_cfg_t *xosc
  * \retval      Function execution status.
  *******************************************************************/
 LR11XX_HW_API_status_t LR11XX_HW_API_get_pa_pwr_cfg(LR11XX_HW_API_pa_pwr_cfg_t *pa_pwr_cfg, sfx_u32 rf_freq_in_hz, sfx_s8 expected_output_pwr_in_dbm);
+#endif
+
+#ifdef LR11XX_RF_API_POWER_POLICY
+/*!******************************************************************
+ * \fn LR11XX_HW_API_status_t LR11XX_HW_API_get_power_timings(LR11XX_HW_API_power_timings_t *power_timings);
+ * \brief Get the measured exit times of the low power modes used between two frames.
+ * \param[out]  power_timings: Pointer to the structure that will contain the board timings.
+ * \retval      Function execution status.
+ *******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_get_power_timings(LR11XX_HW_API_power_timings_t *power_timings);
+#endif
+
+#if (defined LR11XX_RF_API_REG_MODE_POLICY) && !(defined LR11XX_HW_API_STATIC_CONFIG)
+/*!******************************************************************
+ * \fn LR11XX_HW_API_status_t LR11XX_HW_API_get_reg_mode_cfg(LR11XX_HW_API_reg_mode_cfg_t *reg_mode_cfg);
+ * \brief Get the regulator capabilities of the board, used to select the DC-DC or the LDO for each radio operation.
+ * \param[in]  	none
+ * \param[out] 	reg_mode_cfg: Pointer to the regulator configuration structure.
+ * \retval		Function execution status.
+ *******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_get_reg_mode_cfg(LR11XX_HW_API_reg_mode_cfg_t *reg_mode_cfg);
+#endif
+
+#ifdef LR11XX_RF_API_RC_PROFILES
+/*!******************************************************************
+ * \fn LR11XX_HW_API_status_t LR11XX_HW_API_set_rc(const SIGFOX_rc_t *rc);
+ * \brief Select the radio configuration used by the next calls to LR11XX_HW_API_get_fem_mask(), LR11XX_HW_API_get_xosc_cfg() and LR11XX_HW_API_get_pa_pwr_cfg().
+ * \brief This function is called when an RC profile is loaded or switched, to manage multi-RC front-ends.
+ * \param[in]  rc: Radio configuration to select.
+ * \param[out] none
+ * \retval     Function execution status.
+ *******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_set_rc(const SIGFOX_rc_t *rc);
+#endif
+
+#ifdef LR11XX_RF_API_RTC_WAIT
+/*!******************************************************************
+ * \fn LR11XX_HW_API_status_t LR11XX_HW_API_rtc_wait_irq_enable(sfx_bool enable);
+ * \brief Route the chip wake-up (BUSY falling edge) to the gpio_irq_callback function given in LR11XX_HW_API_open(), instead of the radio interrupt.
+ * \brief This function is called with SIGFOX_TRUE before the chip is put to sleep by LR11XX_RF_API_start_rtc_wait(), and with SIGFOX_FALSE by LR11XX_RF_API_stop_rtc_wait().
+ * \param[in]  	enable: SIGFOX_TRUE to route the chip wake-up, SIGFOX_FALSE to restore the radio interrupt.
+ * \param[out] 	none
+ * \retval		Function execution status.
+ *******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_rtc_wait_irq_enable(sfx_bool enable);
+#endif
+
+#if ((defined LR11XX_RF_API_SWEEP) || (defined LR11XX_RF_API_SPECTRUM_SCAN)) && (defined SIGFOX_EP_ASYNCHRONOUS)
+/*!******************************************************************
+ * \fn LR11XX_HW_API_status_t LR11XX_HW_API_timer_start(sfx_u32 duration_ms);
+ * \brief Start the sweep dwell or spectrum scan sample timer. The timer_irq_callback function given in LR11XX_HW_API_open() must be called when the duration has elapsed.
+ * \param[in]  	duration_ms: Timer duration in ms.
+ * \param[out] 	none
+ * \retval		Function execution status.
+ *******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_timer_start(sfx_u32 duration_ms);
+#endif
+
+#if ((defined LR11XX_RF_API_SWEEP) || (defined LR11XX_RF_API_SPECTRUM_SCAN)) && (defined SIGFOX_EP_ASYNCHRONOUS)
+/*!******************************************************************
+ * \fn LR11XX_HW_API_status_t LR11XX_HW_API_timer_stop(void);
+ * \brief Stop the sweep dwell or spectrum scan sample timer.
+ * \param[in]  	none
+ * \param[out] 	none
+ * \retval		Function execution status.
+ *******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_timer_stop(void);
+#endif
+
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+/*!******************************************************************
+ * \fn LR11XX_HW_API_status_t LR11XX_HW_API_wait_irq(void);
+ * \brief Called repeatedly by the blocking TX, RX and sweep loops while the chip IRQ has not been received.
+ * \brief The function can return immediately (busy polling), or put the MCU in a low power mode which is exited on the gpio_irq_callback interrupt.
+ * \param[in]  	none
+ * \param[out] 	none
+ * \retval		Function execution status.
+ *******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_wait_irq(void);
+#endif
 
 /*!******************************************************************
  * \fn LR11XX_HW_API_status_t LR11XX_HW_API_tx_on(void);
@@ -282,7 +486,7 @@ LR11XX_HW_API_status_t LR11XX_HW_API_rx_on(void);
 LR11XX_HW_API_status_t LR11XX_HW_API_rx_off(void);
 #endif
 
-#if (defined SIGFOX_EP_TIMER_REQUIRED) && (defined SIGFOX_EP_LATENCY_COMPENSATION)
+#if (defined SIGFOX_EP_TIMER_REQUIRED) && (defined SIGFOX_EP_LATENCY_COMPENSATION) && !(defined LR11XX_HW_API_STATIC_CONFIG)
 /*!******************************************************************
  * \fn LR11XX_HW_API_status_t LR11XX_HW_API_get_latency(LR11XX_HW_API_latency_t latency_type, sfx_u32 *latency_ms)
  * \brief Read HW functions latency in milliseconds.
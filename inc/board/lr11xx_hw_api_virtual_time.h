@@ -0,0 +1,168 @@
+/*!*****************************************************************
+ * \file    lr11xx_hw_api_virtual_time.h
+ * \brief   LR11XX HW API virtual time implementation for host simulation.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2024, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#ifndef __LR11XX_HW_API_VIRTUAL_TIME_H__
+#define __LR11XX_HW_API_VIRTUAL_TIME_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "board/lr11xx_hw_api.h"
+#ifdef LR11XX_HW_API_VIRTUAL_TIME_MCU_API
+#include "manuf/mcu_api.h"
+#endif
+
+#include <stdint.h>
+
+#if (defined LR11XX_HW_API_VIRTUAL_TIME_MCU_API) && !(defined LR11XX_HW_API_VIRTUAL_TIME)
+#error "LR11XX_HW_API_VIRTUAL_TIME flag needed with LR11XX_HW_API_VIRTUAL_TIME_MCU_API flag"
+#endif
+
+#ifdef LR11XX_HW_API_VIRTUAL_TIME
+
+/*** LR11XX HW API VIRTUAL TIME macros ***/
+
+#ifndef LR11XX_HW_API_VIRTUAL_TIME_EVENTS
+#define LR11XX_HW_API_VIRTUAL_TIME_EVENTS 16
+#endif
+
+/*** LR11XX HW API VIRTUAL TIME structures ***/
+
+/*!******************************************************************
+ * \enum LR11XX_HW_API_VIRTUAL_TIME_event_t
+ * \brief Simulated events. The identifiers from LR11XX_HW_API_VIRTUAL_TIME_EVENT_USER are free for the host (chip model for example).
+ *******************************************************************/
+typedef enum {
+    LR11XX_HW_API_VIRTUAL_TIME_EVENT_GPIO_IRQ = 0,
+    LR11XX_HW_API_VIRTUAL_TIME_EVENT_TIMER_IRQ,
+#if (defined LR11XX_HW_API_VIRTUAL_TIME_MCU_API) && (defined SIGFOX_EP_TIMER_REQUIRED)
+    // One event per MCU API timer instance.
+    LR11XX_HW_API_VIRTUAL_TIME_EVENT_MCU_TIMER,
+    LR11XX_HW_API_VIRTUAL_TIME_EVENT_USER = (LR11XX_HW_API_VIRTUAL_TIME_EVENT_MCU_TIMER + MCU_API_TIMER_INSTANCE_LAST)
+#else
+    LR11XX_HW_API_VIRTUAL_TIME_EVENT_USER
+#endif
+} LR11XX_HW_API_VIRTUAL_TIME_event_t;
+
+/*** LR11XX HW API VIRTUAL TIME functions ***/
+
+/*!******************************************************************
+ * \fn void LR11XX_HW_API_VIRTUAL_TIME_reset(void)
+ * \brief Set the simulated time back to 0 and cancel all the pending events.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void LR11XX_HW_API_VIRTUAL_TIME_reset(void);
+
+/*!******************************************************************
+ * \fn void LR11XX_HW_API_VIRTUAL_TIME_open(const LR11XX_HW_API_config_t *hw_api_config)
+ * \brief Register the IRQ callbacks given to LR11XX_HW_API_open(), to be called from the host implementation of this function.
+ * \param[in]   hw_api_config: Pointer to the HW API configuration.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void LR11XX_HW_API_VIRTUAL_TIME_open(const LR11XX_HW_API_config_t *hw_api_config);
+
+/*!******************************************************************
+ * \fn uint64_t LR11XX_HW_API_VIRTUAL_TIME_get_time_us(void)
+ * \brief Get the simulated time.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Simulated time in microseconds since the last reset.
+ *******************************************************************/
+uint64_t LR11XX_HW_API_VIRTUAL_TIME_get_time_us(void);
+
+/*!******************************************************************
+ * \fn void LR11XX_HW_API_VIRTUAL_TIME_set_event(sfx_u8 event_id, sfx_u32 delay_us, LR11XX_HW_API_irq_cb_t event_cb)
+ * \brief Schedule an event after the given simulated delay. A pending event with the same identifier is replaced.
+ * \param[in]   event_id: Event identifier, lower than LR11XX_HW_API_VIRTUAL_TIME_EVENTS.
+ * \param[in]   delay_us: Delay from the current simulated time in microseconds.
+ * \param[in]   event_cb: Function called when the event expires, SIGFOX_NULL for a deadline only checked with LR11XX_HW_API_VIRTUAL_TIME_is_event_pending().
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void LR11XX_HW_API_VIRTUAL_TIME_set_event(sfx_u8 event_id, sfx_u32 delay_us, LR11XX_HW_API_irq_cb_t event_cb);
+
+/*!******************************************************************
+ * \fn void LR11XX_HW_API_VIRTUAL_TIME_cancel_event(sfx_u8 event_id)
+ * \brief Cancel a pending event.
+ * \param[in]   event_id: Event identifier.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void LR11XX_HW_API_VIRTUAL_TIME_cancel_event(sfx_u8 event_id);
+
+/*!******************************************************************
+ * \fn sfx_bool LR11XX_HW_API_VIRTUAL_TIME_is_event_pending(sfx_u8 event_id)
+ * \brief Check if an event has not expired yet.
+ * \param[in]   event_id: Event identifier.
+ * \param[out]  none
+ * \retval      SIGFOX_TRUE if the event is scheduled and has not expired, SIGFOX_FALSE otherwise.
+ *******************************************************************/
+sfx_bool LR11XX_HW_API_VIRTUAL_TIME_is_event_pending(sfx_u8 event_id);
+
+/*!******************************************************************
+ * \fn void LR11XX_HW_API_VIRTUAL_TIME_raise_irq(sfx_u32 delay_us)
+ * \brief Deliver the chip IRQ to the RF API after the given simulated delay (end of a simulated TX or RX operation).
+ * \param[in]   delay_us: Delay from the current simulated time in microseconds.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void LR11XX_HW_API_VIRTUAL_TIME_raise_irq(sfx_u32 delay_us);
+
+/*!******************************************************************
+ * \fn void LR11XX_HW_API_VIRTUAL_TIME_advance(sfx_u32 duration_us)
+ * \brief Move the simulated time forward, expiring the events which fall in the interval in chronological order.
+ * \param[in]   duration_us: Duration in microseconds.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void LR11XX_HW_API_VIRTUAL_TIME_advance(sfx_u32 duration_us);
+
+/*!******************************************************************
+ * \fn sfx_bool LR11XX_HW_API_VIRTUAL_TIME_run_next_event(void)
+ * \brief Jump to the next pending event and expire it. This function is called by LR11XX_HW_API_wait_irq() and the MCU API timers of the lr11xx_mcu_api_virtual_time.c module instead of busy waiting.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      SIGFOX_FALSE if there was no pending event, SIGFOX_TRUE otherwise.
+ *******************************************************************/
+sfx_bool LR11XX_HW_API_VIRTUAL_TIME_run_next_event(void);
+
+#endif /* LR11XX_HW_API_VIRTUAL_TIME */
+
+#endif /* __LR11XX_HW_API_VIRTUAL_TIME_H__ */
@@ -0,0 +1,154 @@
+/*!*****************************************************************
+ * \file    lr11xx_dbpsk_baseband.h
+ * \brief   DBPSK I/Q baseband generator and demodulator for host simulation.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2024, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#ifndef __LR11XX_DBPSK_BASEBAND_H__
+#define __LR11XX_DBPSK_BASEBAND_H__
+
+#include "lr11xx_radio_types.h"
+
+#include <stdint.h>
+
+/*** LR11XX DBPSK BASEBAND macros ***/
+
+#ifndef LR11XX_DBPSK_BASEBAND_OVERSAMPLING_MAX
+#define LR11XX_DBPSK_BASEBAND_OVERSAMPLING_MAX 64
+#endif
+// Lowest oversampling giving one sample per quarter of bit to the demodulator.
+#define LR11XX_DBPSK_BASEBAND_OVERSAMPLING_MIN 4
+// Ramps are limited to two bits, the longest one (ramp-down at 100bps) lasts less than one bit.
+#define LR11XX_DBPSK_BASEBAND_RAMP_LEN_MAX (2 * LR11XX_DBPSK_BASEBAND_OVERSAMPLING_MAX)
+
+/*** LR11XX DBPSK BASEBAND structures ***/
+
+/*!******************************************************************
+ * \enum LR11XX_DBPSK_BASEBAND_status_t
+ * \brief DBPSK baseband error codes.
+ *******************************************************************/
+typedef enum {
+    LR11XX_DBPSK_BASEBAND_SUCCESS = 0,
+    LR11XX_DBPSK_BASEBAND_ERROR_NULL_PARAMETER,
+    LR11XX_DBPSK_BASEBAND_ERROR_BIT_RATE,
+    LR11XX_DBPSK_BASEBAND_ERROR_OVERSAMPLING,
+    LR11XX_DBPSK_BASEBAND_ERROR_PKT_PARAMS,
+    // Last index.
+    LR11XX_DBPSK_BASEBAND_ERROR_LAST
+} LR11XX_DBPSK_BASEBAND_status_t;
+
+/*!******************************************************************
+ * \struct LR11XX_DBPSK_BASEBAND_iq_t
+ * \brief Complex baseband sample.
+ *******************************************************************/
+typedef struct {
+    float i;
+    float q;
+} LR11XX_DBPSK_BASEBAND_iq_t;
+
+/*!******************************************************************
+ * \struct LR11XX_DBPSK_BASEBAND_t
+ * \brief DBPSK baseband context. The pulse shapes are computed once by LR11XX_DBPSK_BASEBAND_init() and LR11XX_DBPSK_BASEBAND_set_pkt_params(), already rotated by the carrier phase.
+ *******************************************************************/
+typedef struct {
+    uint32_t bit_rate_bps;
+    uint16_t oversampling;
+    LR11XX_DBPSK_BASEBAND_iq_t carrier;
+    // Amplitude during a phase change: half cosine from +1 to -1.
+    LR11XX_DBPSK_BASEBAND_iq_t transition[LR11XX_DBPSK_BASEBAND_OVERSAMPLING_MAX];
+    // Raised cosine ramps of the PA before the first bit and after the last bit.
+    LR11XX_DBPSK_BASEBAND_iq_t ramp_up[LR11XX_DBPSK_BASEBAND_RAMP_LEN_MAX];
+    LR11XX_DBPSK_BASEBAND_iq_t ramp_down[LR11XX_DBPSK_BASEBAND_RAMP_LEN_MAX];
+    uint16_t ramp_up_delay_us;
+    uint16_t ramp_down_delay_us;
+    uint16_t ramp_up_len_in_samples;
+    uint16_t ramp_down_len_in_samples;
+    uint16_t pld_len_in_bits;
+} LR11XX_DBPSK_BASEBAND_t;
+
+/*** LR11XX DBPSK BASEBAND functions ***/
+
+/*!******************************************************************
+ * \fn LR11XX_DBPSK_BASEBAND_status_t LR11XX_DBPSK_BASEBAND_init(LR11XX_DBPSK_BASEBAND_t *baseband, uint32_t bit_rate_bps, uint16_t oversampling, float carrier_phase_rad)
+ * \brief Initialize the baseband context and compute the phase change pulse shape.
+ * \param[in]   baseband: Pointer to the context to initialize.
+ * \param[in]   bit_rate_bps: Bit rate in bps (the sampling rate is bit_rate_bps * oversampling).
+ * \param[in]   oversampling: Number of samples per bit, from LR11XX_DBPSK_BASEBAND_OVERSAMPLING_MIN to LR11XX_DBPSK_BASEBAND_OVERSAMPLING_MAX.
+ * \param[in]   carrier_phase_rad: Phase of the carrier applied to all the generated samples.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+LR11XX_DBPSK_BASEBAND_status_t LR11XX_DBPSK_BASEBAND_init(LR11XX_DBPSK_BASEBAND_t *baseband, uint32_t bit_rate_bps, uint16_t oversampling, float carrier_phase_rad);
+
+/*!******************************************************************
+ * \fn LR11XX_DBPSK_BASEBAND_status_t LR11XX_DBPSK_BASEBAND_set_pkt_params(LR11XX_DBPSK_BASEBAND_t *baseband, const lr11xx_radio_pkt_params_bpsk_t *pkt_params)
+ * \brief Set the packet parameters given to the radio. The ramp shapes are only computed again when the ramp delays change.
+ * \param[in]   baseband: Pointer to the context.
+ * \param[in]   pkt_params: Pointer to the BPSK packet parameters (ramp delays in microseconds, as the LR11XX_RADIO_SIGFOX_DBPSK_RAMP_* values).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+LR11XX_DBPSK_BASEBAND_status_t LR11XX_DBPSK_BASEBAND_set_pkt_params(LR11XX_DBPSK_BASEBAND_t *baseband, const lr11xx_radio_pkt_params_bpsk_t *pkt_params);
+
+/*!******************************************************************
+ * \fn uint32_t LR11XX_DBPSK_BASEBAND_get_len_in_samples(const LR11XX_DBPSK_BASEBAND_t *baseband)
+ * \brief Get the number of samples of the frame, ramps included.
+ * \param[in]   baseband: Pointer to the context.
+ * \param[out]  none
+ * \retval      Frame length in samples.
+ *******************************************************************/
+uint32_t LR11XX_DBPSK_BASEBAND_get_len_in_samples(const LR11XX_DBPSK_BASEBAND_t *baseband);
+
+/*!******************************************************************
+ * \fn uint32_t LR11XX_DBPSK_BASEBAND_modulate(const LR11XX_DBPSK_BASEBAND_t *baseband, const uint8_t *buffer, uint32_t first_sample, LR11XX_DBPSK_BASEBAND_iq_t *iq_out, uint32_t sample_count)
+ * \brief Generate a block of I/Q samples of the frame. Successive calls with consecutive blocks give the same samples as a single call on the whole frame.
+ * \param[in]   baseband: Pointer to the context.
+ * \param[in]   buffer: DBPSK encoded buffer written to the radio (pld_len_in_bits bits).
+ * \param[in]   first_sample: Index of the first sample of the block in the frame.
+ * \param[in]   sample_count: Size of the block in samples.
+ * \param[out]  iq_out: Pointer to the generated samples.
+ * \retval      Number of samples generated, lower than sample_count at the end of the frame.
+ *******************************************************************/
+uint32_t LR11XX_DBPSK_BASEBAND_modulate(const LR11XX_DBPSK_BASEBAND_t *baseband, const uint8_t *buffer, uint32_t first_sample, LR11XX_DBPSK_BASEBAND_iq_t *iq_out, uint32_t sample_count);
+
+/*!******************************************************************
+ * \fn void LR11XX_DBPSK_BASEBAND_demodulate(const LR11XX_DBPSK_BASEBAND_t *baseband, const LR11XX_DBPSK_BASEBAND_iq_t *iq_in, uint8_t *data_out)
+ * \brief Recover the data given to dbpsk_encode_buffer() from the I/Q samples of a frame, by differential detection between the first and the last quarter of each bit. The result does not depend on the carrier phase.
+ * \param[in]   baseband: Pointer to the context.
+ * \param[in]   iq_in: Pointer to the LR11XX_DBPSK_BASEBAND_get_len_in_samples() samples of the frame.
+ * \param[out]  data_out: Pointer to the decoded data (pld_len_in_bits - 2 bits, last byte left aligned).
+ * \retval      none
+ *******************************************************************/
+void LR11XX_DBPSK_BASEBAND_demodulate(const LR11XX_DBPSK_BASEBAND_t *baseband, const LR11XX_DBPSK_BASEBAND_iq_t *iq_in, uint8_t *data_out);
+
+#endif /* __LR11XX_DBPSK_BASEBAND_H__ */
@@ -64,11 +64,332 @@ typedef enum {
     // Activate the SIGFOX_EP_ERROR_STACK flag and use the SIGFOX_EP_API_unstack_error() function to get more details.
     LR11XX_RF_API_ERROR_DRIVER_MCU_API,
     LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API,
+    // Appended after the low level errors so that the existing values are unchanged.
+    LR11XX_RF_API_ERROR_CHIP_BUSY,
+    LR11XX_RF_API_ERROR_RC_PROFILE,
+    LR11XX_RF_API_ERROR_SWEEP,
+    LR11XX_RF_API_ERROR_TX_POWER,
+    LR11XX_RF_API_ERROR_CHIP_VARIANT,
+    LR11XX_RF_API_ERROR_SPECTRUM_SCAN,
+    LR11XX_RF_API_ERROR_RTC_WAIT,
     // Last index.
     SIGFOX_RF_API_ERROR_LAST
 } LR11XX_RF_API_status_t;
 #endif
 
+/*!******************************************************************
+ * \enum LR11XX_RF_API_chip_variant_t
+ * \brief LR11XX chip variant, read from the chip at first wake-up.
+ *******************************************************************/
+typedef enum {
+    LR11XX_RF_API_CHIP_VARIANT_UNKNOWN = 0,
+    LR11XX_RF_API_CHIP_VARIANT_LR1110,
+    LR11XX_RF_API_CHIP_VARIANT_LR1120,
+    LR11XX_RF_API_CHIP_VARIANT_LR1121,
+    LR11XX_RF_API_CHIP_VARIANT_LAST
+} LR11XX_RF_API_chip_variant_t;
+
+#ifdef LR11XX_RF_API_COEXISTENCE
+/*!******************************************************************
+ * \enum LR11XX_RF_API_coex_owner_t
+ * \brief Current owner of the LR11XX chip.
+ *******************************************************************/
+typedef enum {
+    LR11XX_RF_API_COEX_OWNER_NONE = 0,
+    LR11XX_RF_API_COEX_OWNER_SIGFOX,
+    LR11XX_RF_API_COEX_OWNER_EXTERNAL,
+    LR11XX_RF_API_COEX_OWNER_LAST
+} LR11XX_RF_API_coex_owner_t;
+#endif
+
+#ifdef LR11XX_RF_API_COEXISTENCE
+/********************************
+ * \brief LR11XX coexistence callback functions.
+ * \fn LR11XX_RF_API_coex_granted_cb_t To be called when the chip is handed over to the external user (GNSS or Wi-Fi scan).
+ *******************************/
+typedef void (*LR11XX_RF_API_coex_granted_cb_t)(void);
+#endif
+
+#ifdef LR11XX_RF_API_RTC_WAIT
+/********************************
+ * \brief LR11XX RTC wait callback functions.
+ * \fn LR11XX_RF_API_rtc_wait_cplt_cb_t To be called from the IRQ context when the chip wakes up at the end of the wait.
+ *******************************/
+typedef void (*LR11XX_RF_API_rtc_wait_cplt_cb_t)(void);
+#endif
+
+#if (defined SIGFOX_EP_BIDIRECTIONAL) && (defined LR11XX_RF_API_DL_VALIDATION)
+/********************************
+ * \brief LR11XX downlink validation functions.
+ * \fn LR11XX_RF_API_dl_validation_cb_t To be called from LR11XX_RF_API_process() on each received downlink frame, returns SIGFOX_FALSE to drop the frame and keep listening.
+ *******************************/
+typedef sfx_bool (*LR11XX_RF_API_dl_validation_cb_t)(const sfx_u8 *dl_phy_content, sfx_u8 dl_phy_content_size);
+#endif
+
+#ifdef LR11XX_RF_API_SWEEP
+/*!******************************************************************
+ * \enum LR11XX_RF_API_sweep_mode_t
+ * \brief Signal transmitted on each sweep point.
+ *******************************************************************/
+typedef enum {
+    LR11XX_RF_API_SWEEP_MODE_CW = 0,
+    LR11XX_RF_API_SWEEP_MODE_DBPSK,
+    LR11XX_RF_API_SWEEP_MODE_LAST
+} LR11XX_RF_API_sweep_mode_t;
+#endif
+
+#ifdef LR11XX_RF_API_SWEEP
+/*!******************************************************************
+ * \struct LR11XX_RF_API_sweep_point_t
+ * \brief Sweep point parameters.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 frequency_hz;
+    sfx_s8 tx_power_dbm_eirp;
+    sfx_u32 dwell_ms;
+} LR11XX_RF_API_sweep_point_t;
+#endif
+
+#if (defined LR11XX_RF_API_SWEEP) && (defined SIGFOX_EP_ASYNCHRONOUS)
+/********************************
+ * \brief LR11XX sweep callback functions.
+ * \fn LR11XX_RF_API_sweep_cplt_cb_t To be called when the last point of the sweep is completed.
+ *******************************/
+typedef void (*LR11XX_RF_API_sweep_cplt_cb_t)(void);
+#endif
+
+#ifdef LR11XX_RF_API_SWEEP
+/*!******************************************************************
+ * \struct LR11XX_RF_API_sweep_config_t
+ * \brief Sweep configuration structure.
+ *******************************************************************/
+typedef struct {
+    const LR11XX_RF_API_sweep_point_t *points;
+    sfx_u16 number_of_points;
+    LR11XX_RF_API_sweep_mode_t mode;
+    sfx_u16 bit_rate_bps;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    LR11XX_RF_API_sweep_cplt_cb_t cplt_cb;
+#endif
+} LR11XX_RF_API_sweep_config_t;
+#endif
+
+#ifdef LR11XX_RF_API_SPECTRUM_SCAN
+/*!******************************************************************
+ * \struct LR11XX_RF_API_scan_result_t
+ * \brief RSSI statistics of one scanned channel.
+ *******************************************************************/
+typedef struct {
+    sfx_s16 rssi_min_dbm;
+    sfx_s16 rssi_mean_dbm;
+    sfx_s16 rssi_max_dbm;
+} LR11XX_RF_API_scan_result_t;
+#endif
+
+#if (defined LR11XX_RF_API_SPECTRUM_SCAN) && (defined SIGFOX_EP_ASYNCHRONOUS)
+/********************************
+ * \brief LR11XX spectrum scan callback functions.
+ * \fn LR11XX_RF_API_scan_cplt_cb_t To be called when the last channel of the scan is completed.
+ *******************************/
+typedef void (*LR11XX_RF_API_scan_cplt_cb_t)(void);
+#endif
+
+#ifdef LR11XX_RF_API_SPECTRUM_SCAN
+/*!******************************************************************
+ * \struct LR11XX_RF_API_scan_config_t
+ * \brief Spectrum scan configuration structure.
+ *******************************************************************/
+typedef struct {
+    const sfx_u32 *frequencies_hz;        // List of channel frequencies, SIGFOX_NULL to scan the range defined by start_frequency_hz and step_hz.
+    sfx_u32 start_frequency_hz;
+    sfx_u32 step_hz;
+    sfx_u16 number_of_channels;
+    sfx_u32 dwell_ms;                     // Listening time on each channel.
+    sfx_u16 sample_period_ms;             // Time between two RSSI samples, at least one sample is taken per channel.
+    LR11XX_RF_API_scan_result_t *results; // Array of number_of_channels entries filled by the scan.
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    LR11XX_RF_API_scan_cplt_cb_t cplt_cb;
+#endif
+} LR11XX_RF_API_scan_config_t;
+#endif
+
+#ifdef LR11XX_RF_API_ERROR_RECOVERY
+/*!******************************************************************
+ * \enum LR11XX_RF_API_fault_t
+ * \brief Classification of the last chip fault handled by the recovery layer.
+ *******************************************************************/
+typedef enum {
+    LR11XX_RF_API_FAULT_NONE = 0,
+    LR11XX_RF_API_FAULT_COMMAND, // Command failure without any chip error (SPI glitch).
+    LR11XX_RF_API_FAULT_ADC,     // ADC calibration error.
+    LR11XX_RF_API_FAULT_IMAGE,   // Image calibration error.
+    LR11XX_RF_API_FAULT_RC,      // HF or LF RC calibration error.
+    LR11XX_RF_API_FAULT_PLL,     // PLL calibration or lock error.
+    LR11XX_RF_API_FAULT_XOSC,    // Oscillator start error: a full reset is required.
+    LR11XX_RF_API_FAULT_LAST
+} LR11XX_RF_API_fault_t;
+#endif
+
+#ifdef LR11XX_RF_API_ERROR_RECOVERY
+/*!******************************************************************
+ * \struct LR11XX_RF_API_recovery_info_t
+ * \brief Error recovery diagnostic structure.
+ *******************************************************************/
+typedef struct {
+    LR11XX_RF_API_fault_t last_fault;
+    sfx_u16 last_chip_errors;
+    sfx_u8 consecutive_recovery_count;
+    sfx_u32 recovery_count;
+    sfx_u32 reset_count;
+} LR11XX_RF_API_recovery_info_t;
+#endif
+
+#ifdef LR11XX_RF_API_SHARED_BUS
+/*!******************************************************************
+ * \struct LR11XX_RF_API_bus_stats_t
+ * \brief SPI bus hold time statistics.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 acquire_count;
+    sfx_u32 hold_time_last_us;
+    sfx_u32 hold_time_max_us;
+    sfx_u32 hold_time_total_us;
+} LR11XX_RF_API_bus_stats_t;
+#endif
+
+#ifdef LR11XX_RF_API_POWER_POLICY
+/*!******************************************************************
+ * \enum LR11XX_RF_API_gap_mode_t
+ * \brief Chip state between two frames of a Sigfox sequence.
+ *******************************************************************/
+typedef enum {
+    LR11XX_RF_API_GAP_MODE_STANDBY_XOSC = 0,
+    LR11XX_RF_API_GAP_MODE_STANDBY_RC,
+    LR11XX_RF_API_GAP_MODE_SLEEP,
+    LR11XX_RF_API_GAP_MODE_LAST
+} LR11XX_RF_API_gap_mode_t;
+#endif
+
+#ifdef LR11XX_RF_API_ADAPTIVE_TX_POWER
+// Number of downlink RSSI samples kept for each RC and uplink frequency band.
+#define LR11XX_RF_API_RSSI_HISTORY_SIZE 4
+// Width of the uplink frequency bands used to index the RSSI history.
+#define LR11XX_RF_API_RSSI_HISTORY_BAND_WIDTH_HZ 1000000
+/*!******************************************************************
+ * \struct LR11XX_RF_API_rssi_history_t
+ * \brief Downlink RSSI history of one RC and uplink frequency band.
+ *******************************************************************/
+typedef struct {
+    sfx_u8 rc_index;            // RC profile index (0 without the LR11XX_RF_API_RC_PROFILES flag).
+    sfx_u16 band_index;         // Uplink frequency divided by LR11XX_RF_API_RSSI_HISTORY_BAND_WIDTH_HZ.
+    sfx_u8 rssi_count;          // Number of valid samples.
+    sfx_u8 rssi_index;          // Index of the next sample to be written.
+    sfx_s16 rssi_dbm[LR11XX_RF_API_RSSI_HISTORY_SIZE];
+    sfx_u8 power_reduction_db;  // TX power reduction currently applied in this band.
+} LR11XX_RF_API_rssi_history_t;
+#endif
+
+#ifdef LR11XX_RF_API_ADAPTIVE_TX_POWER
+/********************************
+ * \brief LR11XX TX power policy functions.
+ * \fn LR11XX_RF_API_tx_power_policy_cb_t To be called on each new downlink RSSI sample, returns the suggested TX power in dBm for the corresponding band.
+ *******************************/
+typedef sfx_s8 (*LR11XX_RF_API_tx_power_policy_cb_t)(const LR11XX_RF_API_rssi_history_t *rssi_history, sfx_s8 tx_power_dbm_eirp);
+#endif
+
+#if (defined LR11XX_RF_API_STATISTICS) || (defined LR11XX_RF_API_FLIGHT_RECORDER)
+/*!******************************************************************
+ * \enum LR11XX_RF_API_function_t
+ * \brief RF API functions used to account the SPI traffic and to tag the flight recorder events.
+ *******************************************************************/
+typedef enum {
+    LR11XX_RF_API_FUNCTION_OPEN = 0,
+    LR11XX_RF_API_FUNCTION_CLOSE,
+    LR11XX_RF_API_FUNCTION_PROCESS,
+    LR11XX_RF_API_FUNCTION_WAKE_UP,
+    LR11XX_RF_API_FUNCTION_SLEEP,
+    LR11XX_RF_API_FUNCTION_INIT,
+    LR11XX_RF_API_FUNCTION_DE_INIT,
+    LR11XX_RF_API_FUNCTION_SEND,
+    LR11XX_RF_API_FUNCTION_RECEIVE,
+    LR11XX_RF_API_FUNCTION_GET_DL_PHY_CONTENT_AND_RSSI,
+    LR11XX_RF_API_FUNCTION_START_CONTINUOUS_WAVE,
+    LR11XX_RF_API_FUNCTION_ERROR,
+    LR11XX_RF_API_FUNCTION_OTHER, // Specific LR11XX functions (RC profiles, sweep).
+    LR11XX_RF_API_FUNCTION_LAST
+} LR11XX_RF_API_function_t;
+#endif
+
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+/*!******************************************************************
+ * \enum LR11XX_RF_API_flight_event_t
+ * \brief Flight recorder event types.
+ *******************************************************************/
+typedef enum {
+    LR11XX_RF_API_FLIGHT_EVENT_NONE = 0,
+    LR11XX_RF_API_FLIGHT_EVENT_ENTRY,       // arg8: function.
+    LR11XX_RF_API_FLIGHT_EVENT_EXIT,        // arg8: function, arg32: status (0 without the SIGFOX_EP_ERROR_CODES flag).
+    LR11XX_RF_API_FLIGHT_EVENT_FREQUENCY,   // arg32: frequency in Hz.
+    LR11XX_RF_API_FLIGHT_EVENT_MODULATION,  // arg8: RF mode (high nibble) and modulation (low nibble), arg32: bit rate in bps.
+    LR11XX_RF_API_FLIGHT_EVENT_PA_CONFIG,   // arg8: TX power in dBm, arg32: power, PA selection and supply (high nibble), duty cycle and HP size bytes.
+    LR11XX_RF_API_FLIGHT_EVENT_IRQ,         // arg32: chip IRQ mask.
+    LR11XX_RF_API_FLIGHT_EVENT_CHIP_ERRORS, // arg8: command status, arg32: chip errors.
+    LR11XX_RF_API_FLIGHT_EVENT_LAST
+} LR11XX_RF_API_flight_event_t;
+#endif
+
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+/*!******************************************************************
+ * \struct LR11XX_RF_API_flight_record_t
+ * \brief Flight recorder entry.
+ *******************************************************************/
+typedef struct {
+    sfx_u8 event;
+    sfx_u8 arg8;
+    sfx_u16 delta_time; // Time since the previous record, in us if bit 15 is cleared or in units of 1024 us otherwise.
+    sfx_u32 arg32;
+} LR11XX_RF_API_flight_record_t;
+#endif
+
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+/*!******************************************************************
+ * \struct LR11XX_RF_API_flight_recorder_t
+ * \brief Flight recorder ring, decoded on the host by the cmake/decode_lr11xx_flight_recorder.cmake script.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 magic;
+    sfx_u16 index; // Index of the next record to be written (oldest record).
+    sfx_u16 size;
+    sfx_u32 timestamp_us; // Timestamp of the last record.
+    LR11XX_RF_API_flight_record_t records[LR11XX_RF_API_FLIGHT_RECORDER];
+} LR11XX_RF_API_flight_recorder_t;
+#endif
+
+#ifdef LR11XX_RF_API_STATISTICS
+/*!******************************************************************
+ * \struct LR11XX_RF_API_stats_t
+ * \brief Driver runtime counters.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 spi_command_count[LR11XX_RF_API_FUNCTION_LAST];
+    sfx_u32 spi_byte_count[LR11XX_RF_API_FUNCTION_LAST];
+    sfx_u32 irq_tx_done_count;
+    sfx_u32 irq_rx_done_count;
+    sfx_u32 irq_error_count;
+    sfx_u32 irq_timeout_count;  // TX watchdog elapsed.
+    sfx_u32 irq_other_count;    // IRQ without any enabled source pending.
+    sfx_u32 irq_spurious_count; // IRQ received while the driver is sleeping.
+    sfx_u32 state_error_count;
+#ifdef SIGFOX_EP_ERROR_CODES
+    sfx_u32 error_count[SIGFOX_RF_API_ERROR_LAST];
+#endif
+    sfx_u32 tx_frame_count;
+    sfx_u32 rx_frame_count;
+    sfx_u32 wake_up_count;
+    sfx_u32 cold_wake_up_count;
+} LR11XX_RF_API_stats_t;
+#endif
+
 /*** LR11XX RF API functions ***/
 
 #if (defined SIGFOX_EP_ASYNCHRONOUS) || (defined SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE)
@@ -201,18 +522,354 @@ RF_API_status_t LR11XX_RF_API_carrier_sense(RF_API_carrier_sense_parameters_t *c
 RF_API_status_t LR11XX_RF_API_get_latency(RF_API_latency_t latency_type, sfx_u32 *latency_ms);
 #endif
 
+/*!******************************************************************
+ * \fn RF_API_status_t LR11XX_RF_API_get_ul_airtime(sfx_u8 bitstream_size_bytes, sfx_u16 bit_rate_bps, sfx_u32 *airtime_us)
+ * \brief Compute the on-air duration of an uplink frame, including DBPSK tail bits and BPSK ramps.
+ * \param[in]   bitstream_size_bytes: Size of the uplink bitstream in bytes.
+ * \param[in]   bit_rate_bps: Uplink bit rate in bps.
+ * \param[out]  airtime_us: Pointer to integer that will contain the frame duration in microseconds.
+ * \retval      Function execution status.
+ *******************************************************************/
+RF_API_status_t LR11XX_RF_API_get_ul_airtime(sfx_u8 bitstream_size_bytes, sfx_u16 bit_rate_bps, sfx_u32 *airtime_us);
+
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+/*!******************************************************************
+ * \fn RF_API_status_t LR11XX_RF_API_get_dl_airtime(sfx_u16 bit_rate_bps, sfx_u32 *airtime_us)
+ * \brief Compute the on-air duration of a downlink frame (GFSK preamble, synchronization word and payload).
+ * \param[in]   bit_rate_bps: Downlink bit rate in bps.
+ * \param[out]  airtime_us: Pointer to integer that will contain the frame duration in microseconds.
+ * \retval      Function execution status.
+ *******************************************************************/
+RF_API_status_t LR11XX_RF_API_get_dl_airtime(sfx_u16 bit_rate_bps, sfx_u32 *airtime_us);
+#endif
+
+/*!******************************************************************
+ * \fn LR11XX_RF_API_chip_variant_t LR11XX_RF_API_get_chip_variant(void)
+ * \brief Get the chip variant detected at first wake-up.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Chip variant, LR11XX_RF_API_CHIP_VARIANT_UNKNOWN before the first wake-up.
+ *******************************************************************/
+LR11XX_RF_API_chip_variant_t LR11XX_RF_API_get_chip_variant(void);
+
 #ifdef SIGFOX_EP_CERTIFICATION
 /*!******************************************************************
  * \fn LR11XX_RF_API_status_t RF_API_start_continuous_wave(void)
  * \brief Start continuous wave transmission using radio parameters given in the RF_API_init() function.
  * \brief This function is only called by the type approval addon (EP-ADDON-TA). In asynchronous mode, it must not issue any completion callback.
- * \param[in]  	none
- * \param[out] 	none
- * \retval		Function execution status.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
  *******************************************************************/
 RF_API_status_t LR11XX_RF_API_start_continuous_wave(void);
 #endif
 
+#ifdef LR11XX_RF_API_SWEEP
+/*!******************************************************************
+ * \fn RF_API_status_t LR11XX_RF_API_start_sweep(LR11XX_RF_API_sweep_config_t *sweep_config)
+ * \brief Transmit successively on a list of (frequency, power, dwell) points without calling RF_API_init() between them.
+ * \brief Only the radio parameters which differ from the previous point are sent to the chip. The radio must be woken up with RF_API_wake_up() before.
+ * \brief In CW mode, an unmodulated carrier is emitted during the dwell time. In DBPSK mode, a modulated test pattern is repeated as many times as it fits in the dwell time (at least once).
+ * \brief In blocking mode, this function blocks until the last point is completed.
+ * \brief In asynchronous mode, this function only starts the sweep which is then driven by the LR11XX_HW_API timer and RF_API_process(). End of sweep is notified through the cplt_cb() callback.
+ * \param[in]   sweep_config: Pointer to the sweep configuration. The points array must remain valid until the end of the sweep.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+RF_API_status_t LR11XX_RF_API_start_sweep(LR11XX_RF_API_sweep_config_t *sweep_config);
+#endif
+
+#ifdef LR11XX_RF_API_SWEEP
+/*!******************************************************************
+ * \fn RF_API_status_t LR11XX_RF_API_stop_sweep(void)
+ * \brief Abort the current sweep and put the radio back in standby mode.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+RF_API_status_t LR11XX_RF_API_stop_sweep(void);
+#endif
+
+#ifdef LR11XX_RF_API_SPECTRUM_SCAN
+/*!******************************************************************
+ * \fn RF_API_status_t LR11XX_RF_API_start_spectrum_scan(LR11XX_RF_API_scan_config_t *scan_config)
+ * \brief Measure the instantaneous RSSI on a list or a range of channels and compute its minimum, mean and maximum over the dwell time of each channel.
+ * \brief The radio is configured once in GFSK RX mode with the downlink bandwidth, only the frequency is changed between two channels. The radio must be woken up with RF_API_wake_up() before.
+ * \brief In blocking mode, this function blocks until the last channel is completed.
+ * \brief In asynchronous mode, this function only starts the scan which is then driven by the LR11XX_HW_API timer and RF_API_process(). End of scan is notified through the cplt_cb() callback.
+ * \param[in]   scan_config: Pointer to the scan configuration. The frequencies and results arrays must remain valid until the end of the scan.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+RF_API_status_t LR11XX_RF_API_start_spectrum_scan(LR11XX_RF_API_scan_config_t *scan_config);
+#endif
+
+#ifdef LR11XX_RF_API_SPECTRUM_SCAN
+/*!******************************************************************
+ * \fn RF_API_status_t LR11XX_RF_API_stop_spectrum_scan(void)
+ * \brief Abort the current spectrum scan and put the radio back in standby mode. Results of the channels already completed are kept.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+RF_API_status_t LR11XX_RF_API_stop_spectrum_scan(void);
+#endif
+
+#ifdef LR11XX_RF_API_COEXISTENCE
+/*!******************************************************************
+ * \fn RF_API_status_t LR11XX_RF_API_coex_acquire(LR11XX_RF_API_coex_granted_cb_t granted_cb)
+ * \brief Request the LR11XX chip for an external user (GNSS or Wi-Fi scan) between two Sigfox sequences.
+ * \brief If no Sigfox sequence is running, the chip is granted immediately. Otherwise the request is queued and granted at the end of the current sequence (RF_API_sleep), the chip being left awake in standby.
+ * \brief RF_API_wake_up() returns LR11XX_RF_API_ERROR_CHIP_BUSY as long as the external user holds the chip.
+ * \param[in]   granted_cb: Function called when the chip is granted to the external user.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+RF_API_status_t LR11XX_RF_API_coex_acquire(LR11XX_RF_API_coex_granted_cb_t granted_cb);
+#endif
+
+#ifdef LR11XX_RF_API_COEXISTENCE
+/*!******************************************************************
+ * \fn RF_API_status_t LR11XX_RF_API_coex_release(sfx_bool chip_config_lost)
+ * \brief Give the LR11XX chip back to the Sigfox stack.
+ * \brief The next RF_API_wake_up() only restores the radio state (regulator, standby mode and IRQ mask) unless the chip configuration was lost.
+ * \param[in]   chip_config_lost: Set to SIGFOX_TRUE if the external user reset the chip or put it in cold sleep.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+RF_API_status_t LR11XX_RF_API_coex_release(sfx_bool chip_config_lost);
+#endif
+
+#ifdef LR11XX_RF_API_COEXISTENCE
+/*!******************************************************************
+ * \fn LR11XX_RF_API_coex_owner_t LR11XX_RF_API_coex_get_owner(void)
+ * \brief Get the current owner of the LR11XX chip.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current chip owner.
+ *******************************************************************/
+LR11XX_RF_API_coex_owner_t LR11XX_RF_API_coex_get_owner(void);
+#endif
+
+#ifdef LR11XX_RF_API_RC_PROFILES
+/*!******************************************************************
+ * \fn RF_API_status_t LR11XX_RF_API_load_rc_profile(sfx_u8 profile_index, const SIGFOX_rc_t *rc)
+ * \brief Precompute and cache the board settings (RF switch, TCXO and PA configuration) of a radio configuration.
+ * \brief Profile 0 is automatically loaded with the RC given in RF_API_open() and is the active one by default.
+ * \param[in]   profile_index: Profile slot to fill (lower than LR11XX_RF_API_RC_PROFILES).
+ * \param[in]   rc: Radio configuration of the profile.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+RF_API_status_t LR11XX_RF_API_load_rc_profile(sfx_u8 profile_index, const SIGFOX_rc_t *rc);
+#endif
+
+#ifdef LR11XX_RF_API_RC_PROFILES
+/*!******************************************************************
+ * \fn RF_API_status_t LR11XX_RF_API_switch_rc_profile(sfx_u8 profile_index)
+ * \brief Switch the active radio configuration profile without closing the RF driver.
+ * \brief Only the chip settings which differ from the previous profile are sent. If the radio is sleeping, they are applied at next wake-up.
+ * \param[in]   profile_index: Index of a previously loaded profile.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+RF_API_status_t LR11XX_RF_API_switch_rc_profile(sfx_u8 profile_index);
+#endif
+
+#ifdef LR11XX_RF_API_ERROR_RECOVERY
+/*!******************************************************************
+ * \fn RF_API_status_t LR11XX_RF_API_get_recovery_info(LR11XX_RF_API_recovery_info_t *recovery_info)
+ * \brief Get the classification of the last chip fault and the recovery counters.
+ * \param[in]   none
+ * \param[out]  recovery_info: Pointer to the structure that will contain the recovery diagnostic.
+ * \retval      Function execution status.
+ *******************************************************************/
+RF_API_status_t LR11XX_RF_API_get_recovery_info(LR11XX_RF_API_recovery_info_t *recovery_info);
+#endif
+
+#ifdef LR11XX_RF_API_SHARED_BUS
+/*!******************************************************************
+ * \fn RF_API_status_t LR11XX_RF_API_get_bus_stats(LR11XX_RF_API_bus_stats_t *bus_stats, sfx_bool reset)
+ * \brief Get the SPI bus hold time statistics, measured between each LR11XX_HW_API_bus_acquire() and LR11XX_HW_API_bus_release() call.
+ * \param[in]   reset: Clear the statistics after reading them if SIGFOX_TRUE.
+ * \param[out]  bus_stats: Pointer to the structure that will contain the statistics.
+ * \retval      Function execution status.
+ *******************************************************************/
+RF_API_status_t LR11XX_RF_API_get_bus_stats(LR11XX_RF_API_bus_stats_t *bus_stats, sfx_bool reset);
+#endif
+
+#ifdef LR11XX_RF_API_POWER_POLICY
+/*!******************************************************************
+ * \fn void LR11XX_RF_API_set_gap_hint(sfx_u32 gap_ms)
+ * \brief Set the expected duration between the end of a frame (RF_API_de_init) and the start of the next one (RF_API_init).
+ * \brief The chip state used during the gap is selected from this hint and the board timings given by LR11XX_HW_API_get_power_timings().
+ * \param[in]   gap_ms: Expected gap duration in ms, 0 if unknown (chip kept in XOSC standby).
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void LR11XX_RF_API_set_gap_hint(sfx_u32 gap_ms);
+#endif
+
+#ifdef LR11XX_RF_API_POWER_POLICY
+/*!******************************************************************
+ * \fn LR11XX_RF_API_gap_mode_t LR11XX_RF_API_get_gap_mode(void)
+ * \brief Get the chip state selected for the current or last gap.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current gap mode.
+ *******************************************************************/
+LR11XX_RF_API_gap_mode_t LR11XX_RF_API_get_gap_mode(void);
+#endif
+
+#ifdef LR11XX_RF_API_ADAPTIVE_TX_POWER
+/*!******************************************************************
+ * \fn void LR11XX_RF_API_set_tx_power_policy(LR11XX_RF_API_tx_power_policy_cb_t policy_cb)
+ * \brief Register the policy which suggests a reduced TX power from the downlink RSSI history.
+ * \brief The applied power is never above the one requested by the core library and is reduced by 10 dB at most.
+ * \param[in]   policy_cb: Policy function, SIGFOX_NULL to restore the default margin based policy.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void LR11XX_RF_API_set_tx_power_policy(LR11XX_RF_API_tx_power_policy_cb_t policy_cb);
+#endif
+
+#ifdef LR11XX_RF_API_ADAPTIVE_TX_POWER
+/*!******************************************************************
+ * \fn void LR11XX_RF_API_reset_rssi_history(void)
+ * \brief Clear the downlink RSSI history of all bands, the full TX power is used again.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void LR11XX_RF_API_reset_rssi_history(void);
+#endif
+
+#ifdef LR11XX_RF_API_BULK_MODE
+/*!******************************************************************
+ * \fn void LR11XX_RF_API_bulk_start(void)
+ * \brief Start a bulk session: the chip is kept awake between consecutive messages and the static radio settings are applied once.
+ * \brief Only the frequency is programmed again for each frame as long as the modulation, bit rate and output power do not change.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void LR11XX_RF_API_bulk_start(void);
+#endif
+
+#ifdef LR11XX_RF_API_BULK_MODE
+/*!******************************************************************
+ * \fn RF_API_status_t LR11XX_RF_API_bulk_stop(void)
+ * \brief Stop the current bulk session and put the chip to sleep if it has been kept awake after the last message.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+RF_API_status_t LR11XX_RF_API_bulk_stop(void);
+#endif
+
+#ifdef LR11XX_RF_API_STATISTICS
+/*!******************************************************************
+ * \fn void LR11XX_RF_API_stats_spi_transfer(sfx_u16 transfer_size_bytes)
+ * \brief Account one SPI command in the driver statistics. This function has to be called by the lr11xx_hal_read(), lr11xx_hal_write() and lr11xx_hal_direct_read() functions.
+ * \param[in]   transfer_size_bytes: Total number of bytes exchanged on the SPI bus for this command.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void LR11XX_RF_API_stats_spi_transfer(sfx_u16 transfer_size_bytes);
+#endif
+
+#ifdef LR11XX_RF_API_STATISTICS
+/*!******************************************************************
+ * \fn RF_API_status_t LR11XX_RF_API_get_stats(LR11XX_RF_API_stats_t *stats)
+ * \brief Get the driver runtime counters.
+ * \param[in]   none
+ * \param[out]  stats: Pointer to the structure that will contain the counters.
+ * \retval      Function execution status.
+ *******************************************************************/
+RF_API_status_t LR11XX_RF_API_get_stats(LR11XX_RF_API_stats_t *stats);
+#endif
+
+#ifdef LR11XX_RF_API_STATISTICS
+/*!******************************************************************
+ * \fn void LR11XX_RF_API_reset_stats(void)
+ * \brief Clear all the driver runtime counters.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void LR11XX_RF_API_reset_stats(void);
+#endif
+
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+/*!******************************************************************
+ * \fn const LR11XX_RF_API_flight_recorder_t *LR11XX_RF_API_get_flight_recorder(void)
+ * \brief Get the flight recorder ring, to be dumped for a post-mortem analysis.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Pointer to the flight recorder ring.
+ *******************************************************************/
+const LR11XX_RF_API_flight_recorder_t *LR11XX_RF_API_get_flight_recorder(void);
+#endif
+
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+/*!******************************************************************
+ * \fn void LR11XX_RF_API_reset_flight_recorder(void)
+ * \brief Clear all the flight recorder records.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void LR11XX_RF_API_reset_flight_recorder(void);
+#endif
+
+#ifdef LR11XX_RF_API_RTC_WAIT
+/*!******************************************************************
+ * \fn RF_API_status_t LR11XX_RF_API_start_rtc_wait(sfx_u32 duration_ms, LR11XX_RF_API_rtc_wait_cplt_cb_t cplt_cb)
+ * \brief Put the chip to sleep with its configuration retained and wake it up with its 32 kHz RTC after the given duration, so that the MCU can stop its own timers.
+ * \brief This function can be called between two radio operations (after LR11XX_RF_API_de_init() or LR11XX_RF_API_sleep()). The precision is the one of the chip low frequency clock.
+ * \brief The chip wake-up is routed to the IRQ callback given to LR11XX_HW_API_open() by LR11XX_HW_API_rtc_wait_irq_enable() during the wait.
+ * \param[in]   duration_ms: Wait duration in ms, from 1 to 131071000 ms (32-bit number of RTC steps).
+ * \param[in]   cplt_cb: Function called when the chip wakes up at the end of the wait.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+RF_API_status_t LR11XX_RF_API_start_rtc_wait(sfx_u32 duration_ms, LR11XX_RF_API_rtc_wait_cplt_cb_t cplt_cb);
+#endif
+
+#ifdef LR11XX_RF_API_RTC_WAIT
+/*!******************************************************************
+ * \fn RF_API_status_t LR11XX_RF_API_stop_rtc_wait(void)
+ * \brief End the RTC wait, after its completion or to abort it, and put the chip back in the state it had before the wait.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+RF_API_status_t LR11XX_RF_API_stop_rtc_wait(void);
+#endif
+
+#if (defined SIGFOX_EP_BIDIRECTIONAL) && (defined LR11XX_RF_API_DL_VALIDATION)
+/*!******************************************************************
+ * \fn void LR11XX_RF_API_set_dl_validation(LR11XX_RF_API_dl_validation_cb_t validation_cb)
+ * \brief Register the integrity check run on the DL-PHY content as soon as a frame is received.
+ * \brief A rejected frame is counted and the reception is re-armed without waking up the core library.
+ * \param[in]   validation_cb: Validation function, SIGFOX_NULL to forward all the received frames.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void LR11XX_RF_API_set_dl_validation(LR11XX_RF_API_dl_validation_cb_t validation_cb);
+#endif
+
+#if (defined SIGFOX_EP_BIDIRECTIONAL) && (defined LR11XX_RF_API_DL_VALIDATION)
+/*!******************************************************************
+ * \fn RF_API_status_t LR11XX_RF_API_get_dl_rejected_count(sfx_u32 *dl_rejected_count, sfx_bool reset)
+ * \brief Get the number of received frames dropped by the downlink validation function.
+ * \param[in]   reset: Clear the counter after reading it if SIGFOX_TRUE.
+ * \param[out]  dl_rejected_count: Pointer to the number of rejected frames.
+ * \retval      Function execution status.
+ *******************************************************************/
+RF_API_status_t LR11XX_RF_API_get_dl_rejected_count(sfx_u32 *dl_rejected_count, sfx_bool reset);
+#endif
+
 #ifdef SIGFOX_EP_VERBOSE
 /*!******************************************************************
  * \fn LR11XX_RF_API_status_t RF_API_get_version(sfx_u8 **version, sfx_u8 *version_size_char)
@@ -229,6 +886,7 @@ RF_API_status_t LR11XX_RF_API_get_version(sfx_u8 **version, sfx_u8 *version_size
 /*!******************************************************************
  * \fn void LR11XX_RF_API_error(void)
  * \brief Function called by the library if any error occurred during the processing.
+ * \brief With the LR11XX_RF_API_ERROR_RECOVERY flag, the faulty block is recalibrated and the chip configuration is kept when possible, instead of a full reset.
  * \param[in]   none
  * \param[out]  none
  * \retval      none
@@ -241,5 +899,29 @@ void LR11XX_RF_API_error(void);
 #ifndef SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE
 #error "SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE flag needed with LR1XX_RF flags"
 #endif
+#if (defined LR11XX_RF_API_SWEEP) && !(defined SIGFOX_EP_CERTIFICATION)
+#error "SIGFOX_EP_CERTIFICATION flag needed with LR11XX_RF_API_SWEEP flag"
+#endif
+#if (defined LR11XX_RF_API_FLIGHT_RECORDER) && ((LR11XX_RF_API_FLIGHT_RECORDER < 2) || (LR11XX_RF_API_FLIGHT_RECORDER > 32768) || ((LR11XX_RF_API_FLIGHT_RECORDER & (LR11XX_RF_API_FLIGHT_RECORDER - 1)) != 0))
+#error "LR11XX_RF_API_FLIGHT_RECORDER value must be a power of 2 between 2 and 32768"
+#endif
+#if (defined LR11XX_RF_API_ADAPTIVE_TX_POWER) && !(defined SIGFOX_EP_BIDIRECTIONAL)
+#error "SIGFOX_EP_BIDIRECTIONAL flag needed with LR11XX_RF_API_ADAPTIVE_TX_POWER flag"
+#endif
+#if (defined LR11XX_RF_API_SPECTRUM_SCAN) && !(defined SIGFOX_EP_BIDIRECTIONAL)
+#error "SIGFOX_EP_BIDIRECTIONAL flag needed with LR11XX_RF_API_SPECTRUM_SCAN flag"
+#endif
+#if (defined LR11XX_RF_API_ASYNC_HAL) && !(defined SIGFOX_EP_ASYNCHRONOUS)
+#error "SIGFOX_EP_ASYNCHRONOUS flag needed with LR11XX_RF_API_ASYNC_HAL flag"
+#endif
+#if (defined LR11XX_RF_API_ASYNC_HAL) && (defined LR11XX_RF_API_SHARED_BUS)
+#error "LR11XX_RF_API_ASYNC_HAL flag is not compatible with LR11XX_RF_API_SHARED_BUS flag"
+#endif
+#if (defined LR11XX_RF_API_ERROR_RECOVERY) && ((LR11XX_RF_API_ERROR_RECOVERY < 1) || (LR11XX_RF_API_ERROR_RECOVERY > 255))
+#error "LR11XX_RF_API_ERROR_RECOVERY value must be between 1 and 255"
+#endif
+#if (defined LR11XX_RF_API_RC_PROFILES) && ((LR11XX_RF_API_RC_PROFILES < 1) || (LR11XX_RF_API_RC_PROFILES > 255))
+#error "LR11XX_RF_API_RC_PROFILES value must be between 1 and 255"
+#endif
 
 #endif /* __LR11XX_RF_API_H__ */
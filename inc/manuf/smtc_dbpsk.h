@@ -22,6 +22,147 @@ Buffer with input data
 */
 void dbpsk_encode_buffer(const uint8_t *data_in, int bpsk_pld_len_in_bits, uint8_t *data_out);
 
+/*!
+* \brief State of a chunked differential encoder.
+*/
+typedef struct {
+    uint8_t current;
+} dbpsk_encoder_t;
+
+/*!
+* \brief Start a chunked differential encoding.
+*
+* \param [out] encoder Encoder state to initialize
+*/
+static inline void dbpsk_encoder_init(dbpsk_encoder_t *encoder) {
+    encoder->current = 0;
+}
+
+/*!
+* \brief Encode full bytes of a BPSK frame. The output
+* of successive calls, followed by dbpsk_encode_tail,
+* is identical to the one of dbpsk_encode_buffer.
+*
+* \param [in] encoder Encoder state
+*
+* \param [in] data_in Buffer with input data (only
+* len_in_bytes bytes are read)
+*
+* \param [in] len_in_bytes Number of bytes to encode
+*
+* \param [out] data_out Buffer for output data (can
+* optionally be the same as data_in, len_in_bytes bytes
+* are written)
+*/
+void dbpsk_encode_chunk(dbpsk_encoder_t *encoder, const uint8_t *data_in, int len_in_bytes, uint8_t *data_out);
+
+/*!
+* \brief Encode the last bits of a BPSK frame and
+* terminate the encoding.
+*
+* \param [in] encoder Encoder state
+*
+* \param [in] tail_byte Last bits of the frame, left
+* aligned
+*
+* \param [in] tail_len_in_bits Number of bits of
+* tail_byte to encode (0 to 7)
+*
+* \param [out] data_out Buffer for output data (2 bytes
+* are written when tail_len_in_bits is 7, 1 otherwise)
+*/
+void dbpsk_encode_tail(dbpsk_encoder_t *encoder, uint8_t tail_byte, int tail_len_in_bits, uint8_t *data_out);
+
+#ifdef SMTC_DBPSK_BATCH
+/*!
+* \brief Perform differential encoding of a batch of
+* BPSK frames of the same length. Frame n is read at
+* data_in + (n * data_in_stride) and written at
+* data_out + (n * data_out_stride). The output of each
+* frame is identical to the one of dbpsk_encode_buffer.
+* Full bytes are encoded by 64-bit words, with a prefix
+* XOR of the phase changes, unless SMTC_DBPSK_BATCH_SCALAR
+* is defined. The frames are encoded one after the
+* other: see dbpsk_encode_batch_soa to encode the frames
+* in parallel.
+*
+* \param [in] data_in Input arena (must not overlap
+* data_out)
+*
+* \param [in] data_in_stride Distance between two input
+* frames, in bytes (at least (bpsk_pld_len_in_bits + 7) >> 3)
+*
+* \param [in] bpsk_pld_len_in_bits Length of each input
+* BPSK frame, in bits
+*
+* \param [in] frame_count Number of frames to encode
+*
+* \param [out] data_out Output arena
+*
+* \param [in] data_out_stride Distance between two output
+* frames, in bytes (at least dbpsk_get_pld_len_in_bytes)
+*/
+void dbpsk_encode_batch(const uint8_t *data_in, int data_in_stride, int bpsk_pld_len_in_bits, int frame_count, uint8_t *data_out, int data_out_stride);
+
+/*!
+* \brief Given the length of a BPSK frame, in bits,
+* calculate the number of 64-bit words of each frame
+* after differential encoding by dbpsk_encode_batch_soa.
+*
+* \param [in] bpsk_pld_len_in_bits Length of a BPSK frame,
+* in bits
+*
+* \returns Number of output words per frame
+*/
+static inline int dbpsk_get_batch_soa_len_in_words(int bpsk_pld_len_in_bits) {
+    return (bpsk_pld_len_in_bits + 65) >> 6;
+}
+
+/*!
+* \brief Perform differential encoding of a batch of
+* BPSK frames of the same length, stored as a structure
+* of arrays of 64-bit words: word w of frame n is at
+* index (w * frame_count) + n and holds the bits 64w to
+* 64w + 63 of the frame, the first one in the MSB. Each
+* frame is a lane encoded with a prefix XOR of its phase
+* changes, and the loop over the frames has no
+* dependency between iterations, so that the compiler
+* can vectorize it. The bits of each frame are identical
+* to the output of dbpsk_encode_buffer, followed by
+* zeros. SMTC_DBPSK_BATCH_SCALAR selects a bit serial
+* prefix XOR.
+*
+* \param [in] data_in Input arena, with
+* (bpsk_pld_len_in_bits + 63) >> 6 words per frame (bits
+* after the end of the frame are ignored, must not
+* overlap data_out)
+*
+* \param [in] bpsk_pld_len_in_bits Length of each input
+* BPSK frame, in bits (at least 1)
+*
+* \param [in] frame_count Number of frames to encode
+*
+* \param [out] data_out Output arena, with
+* dbpsk_get_batch_soa_len_in_words words per frame
+*/
+void dbpsk_encode_batch_soa(const uint64_t *data_in, int bpsk_pld_len_in_bits, int frame_count, uint64_t *data_out);
+#endif
+
+/*!
+* \brief Perform differential decoding of a DBPSK
+* encoded buffer, as output by dbpsk_encode_buffer.
+*
+* \param [in] data_in Buffer with DBPSK encoded data
+*
+* \param [in] bpsk_pld_len_in_bits Length of the
+* BPSK frame to recover, in bits (data_in must hold
+* bpsk_pld_len_in_bits + 1 bits)
+*
+* \param [out] data_out Buffer for decoded data (can
+* optionally be the same as data_in)
+*/
+void dbpsk_decode_buffer(const uint8_t *data_in, int bpsk_pld_len_in_bits, uint8_t *data_out);
+
 /*!
 * \brief Given the length of a BPSK frame, in bits,
 * calculate the space necessary to hold the frame after
@@ -4,7 +4,14 @@
  *******************************************************************/
 
 #include "lr11xx_hal.h"
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
 #include "sigfox_types.h"
+#ifdef LR11XX_RF_API_STATISTICS
+#include "manuf/lr11xx_rf_api.h"
+#endif
 
 lr11xx_hal_status_t __attribute__((weak)) lr11xx_hal_reset(const void *context) {
     /* To be implemented by the device manufacturer */
@@ -25,6 +32,9 @@ lr11xx_hal_status_t __attribute__((weak)) lr11xx_hal_read(const void *context, c
     SIGFOX_UNUSED(cbuffer_length);
     SIGFOX_UNUSED(rbuffer);
     SIGFOX_UNUSED(rbuffer_length);
+#ifdef LR11XX_RF_API_STATISTICS
+    LR11XX_RF_API_stats_spi_transfer(cbuffer_length + rbuffer_length);
+#endif
     return LR11XX_HAL_STATUS_ERROR;
 }
 
@@ -35,6 +45,9 @@ lr11xx_hal_status_t __attribute__((weak)) lr11xx_hal_write(const void *context,
     SIGFOX_UNUSED(cbuffer_length);
     SIGFOX_UNUSED(cdata);
     SIGFOX_UNUSED(cdata_length);
+#ifdef LR11XX_RF_API_STATISTICS
+    LR11XX_RF_API_stats_spi_transfer(cbuffer_length + cdata_length);
+#endif
     return LR11XX_HAL_STATUS_ERROR;
 }
 
@@ -43,5 +56,8 @@ lr11xx_hal_status_t __attribute__((weak)) lr11xx_hal_direct_read(const void *con
     SIGFOX_UNUSED(context);
     SIGFOX_UNUSED(buffer);
     SIGFOX_UNUSED(length);
+#ifdef LR11XX_RF_API_STATISTICS
+    LR11XX_RF_API_stats_spi_transfer(length);
+#endif
     return LR11XX_HAL_STATUS_ERROR;
 }
@@ -41,6 +41,9 @@
 #endif
 #include "sigfox_error.h"
 #include "sigfox_types.h"
+#if (defined LR11XX_RF_API_ASYNC_HAL) && (defined LR11XX_RF_API_STATISTICS)
+#include "manuf/lr11xx_rf_api.h"
+#endif
 
 /*** LR11XX HW API functions ***/
 
@@ -70,6 +73,86 @@ LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_delayMs(unsigned shor
     SIGFOX_RETURN();
 }
 
+#ifdef LR11XX_RF_API_SHARED_BUS
+LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_bus_acquire(void) {
+    /* To be implemented by the device manufacturer */
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_ERROR;
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_SHARED_BUS
+LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_bus_release(void) {
+    /* To be implemented by the device manufacturer */
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_ERROR;
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#if (defined LR11XX_RF_API_SHARED_BUS) || (defined LR11XX_RF_API_FLIGHT_RECORDER)
+LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_get_timestamp_us(sfx_u32 *timestamp_us) {
+    /* To be implemented by the device manufacturer */
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_ERROR;
+#endif
+    SIGFOX_UNUSED(timestamp_us);
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_HAL_TX_BUFFER
+LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_get_tx_buffer(sfx_u8 **tx_buffer, sfx_u8 tx_buffer_size_bytes) {
+    /* To be implemented by the device manufacturer */
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_ERROR;
+#endif
+    SIGFOX_UNUSED(tx_buffer);
+    SIGFOX_UNUSED(tx_buffer_size_bytes);
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_ASYNC_HAL
+LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_write_async(const sfx_u8 *cbuffer, sfx_u16 cbuffer_length, const sfx_u8 *cdata, sfx_u16 cdata_length, LR11XX_HW_API_irq_cb_t cplt_cb) {
+    /* To be implemented by the device manufacturer */
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_ERROR;
+#endif
+    SIGFOX_UNUSED(cbuffer);
+    SIGFOX_UNUSED(cbuffer_length);
+    SIGFOX_UNUSED(cdata);
+    SIGFOX_UNUSED(cdata_length);
+    SIGFOX_UNUSED(cplt_cb);
+#ifdef LR11XX_RF_API_STATISTICS
+    LR11XX_RF_API_stats_spi_transfer(cbuffer_length + cdata_length);
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#if (defined LR11XX_RF_API_ASYNC_HAL) && (defined SIGFOX_EP_BIDIRECTIONAL)
+LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_read_async(const sfx_u8 *cbuffer, sfx_u16 cbuffer_length, sfx_u8 *rbuffer, sfx_u16 rbuffer_length, LR11XX_HW_API_irq_cb_t cplt_cb) {
+    /* To be implemented by the device manufacturer */
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_ERROR;
+#endif
+    SIGFOX_UNUSED(cbuffer);
+    SIGFOX_UNUSED(cbuffer_length);
+    SIGFOX_UNUSED(rbuffer);
+    SIGFOX_UNUSED(rbuffer_length);
+    SIGFOX_UNUSED(cplt_cb);
+#ifdef LR11XX_RF_API_STATISTICS
+    LR11XX_RF_API_stats_spi_transfer(cbuffer_length + rbuffer_length);
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifndef LR11XX_HW_API_STATIC_CONFIG
 LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_get_fem_mask(LR11XX_HW_API_FEM_t fem, sfx_u8 *rfsw_dio_mask) {
     /* To be implemented by the device manufacturer */
 #ifdef SIGFOX_EP_ERROR_CODES
@@ -79,7 +162,9 @@ LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_get_fem_mask(LR11XX_H
     SIGFOX_UNUSED(rfsw_dio_mask);
     SIGFOX_RETURN();
 }
+#endif
 
+#ifndef LR11XX_HW_API_STATIC_CONFIG
 LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_get_xosc_cfg(LR11XX_HW_API_xosc_cfg_t *xosc_cfg) {
     /* To be implemented by the device manufacturer */
 #ifdef SIGFOX_EP_ERROR_CODES
@@ -88,7 +173,9 @@ LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_get_xosc_cfg(LR11XX_H
     SIGFOX_UNUSED(xosc_cfg);
     SIGFOX_RETURN();
 }
+#endif
 
+#ifndef LR11XX_HW_API_STATIC_CONFIG
 LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_get_pa_pwr_cfg(LR11XX_HW_API_pa_pwr_cfg_t *pa_pwr_cfg, sfx_u32 rf_freq_in_hz, sfx_s8 expected_output_pwr_in_dbm) {
     /* To be implemented by the device manufacturer */
 #ifdef SIGFOX_EP_ERROR_CODES
@@ -99,6 +186,82 @@ LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_get_pa_pwr_cfg(LR11XX
     SIGFOX_UNUSED(expected_output_pwr_in_dbm);
     SIGFOX_RETURN();
 }
+#endif
+
+#ifdef LR11XX_RF_API_POWER_POLICY
+LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_get_power_timings(LR11XX_HW_API_power_timings_t *power_timings) {
+    /* To be implemented by the device manufacturer */
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_ERROR;
+#endif
+    SIGFOX_UNUSED(power_timings);
+    SIGFOX_RETURN();
+}
+#endif
+
+#if (defined LR11XX_RF_API_REG_MODE_POLICY) && !(defined LR11XX_HW_API_STATIC_CONFIG)
+LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_get_reg_mode_cfg(LR11XX_HW_API_reg_mode_cfg_t *reg_mode_cfg) {
+    /* To be implemented by the device manufacturer */
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_ERROR;
+#endif
+    SIGFOX_UNUSED(reg_mode_cfg);
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_RC_PROFILES
+LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_set_rc(const SIGFOX_rc_t *rc) {
+    /* To be implemented by the device manufacturer */
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_ERROR;
+#endif
+    SIGFOX_UNUSED(rc);
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_RTC_WAIT
+LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_rtc_wait_irq_enable(sfx_bool enable) {
+    /* To be implemented by the device manufacturer */
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_ERROR;
+#endif
+    SIGFOX_UNUSED(enable);
+    SIGFOX_RETURN();
+}
+#endif
+
+#if ((defined LR11XX_RF_API_SWEEP) || (defined LR11XX_RF_API_SPECTRUM_SCAN)) && (defined SIGFOX_EP_ASYNCHRONOUS)
+LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_timer_start(sfx_u32 duration_ms) {
+    /* To be implemented by the device manufacturer */
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_ERROR;
+#endif
+    SIGFOX_UNUSED(duration_ms);
+    SIGFOX_RETURN();
+}
+#endif
+
+#if ((defined LR11XX_RF_API_SWEEP) || (defined LR11XX_RF_API_SPECTRUM_SCAN)) && (defined SIGFOX_EP_ASYNCHRONOUS)
+LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_timer_stop(void) {
+    /* To be implemented by the device manufacturer */
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_ERROR;
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_wait_irq(void) {
+    /* To be implemented by the device manufacturer */
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_SUCCESS;
+#endif
+    SIGFOX_RETURN();
+}
+#endif
 
 LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_tx_on(void) {
     /* To be implemented by the device manufacturer */
@@ -132,7 +295,7 @@ LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_rx_off(void) {
     SIGFOX_RETURN();
 }
 
-#if (defined SIGFOX_EP_TIMER_REQUIRED) && (defined SIGFOX_EP_LATENCY_COMPENSATION)
+#if (defined SIGFOX_EP_TIMER_REQUIRED) && (defined SIGFOX_EP_LATENCY_COMPENSATION) && !(defined LR11XX_HW_API_STATIC_CONFIG)
 /*******************************************************************/
 LR11XX_HW_API_status_t __attribute__((weak)) LR11XX_HW_API_get_latency(LR11XX_HW_API_latency_t latency_type, sfx_u32 *latency_ms) {
     /* To be implemented by the device manufacturer */
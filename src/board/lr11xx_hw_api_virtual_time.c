@@ -0,0 +1,225 @@
+/*!*****************************************************************
+ * \file    lr11xx_hw_api_virtual_time.c
+ * \brief   LR11XX HW API virtual time implementation for host simulation.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2024, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include "board/lr11xx_hw_api_virtual_time.h"
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_error.h"
+#include "sigfox_types.h"
+#include "board/lr11xx_hw_api.h"
+
+#ifdef LR11XX_HW_API_VIRTUAL_TIME
+
+/*** LR11XX HW API VIRTUAL TIME local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    sfx_bool pending;
+    uint64_t expiry_time_us;
+    LR11XX_HW_API_irq_cb_t event_cb;
+} LR11XX_HW_API_VIRTUAL_TIME_event_context_t;
+
+/*******************************************************************/
+typedef struct {
+    uint64_t time_us;
+    LR11XX_HW_API_irq_cb_t gpio_irq_callback;
+#if ((defined LR11XX_RF_API_SWEEP) || (defined LR11XX_RF_API_SPECTRUM_SCAN)) && (defined SIGFOX_EP_ASYNCHRONOUS)
+    LR11XX_HW_API_irq_cb_t timer_irq_callback;
+#endif
+    LR11XX_HW_API_VIRTUAL_TIME_event_context_t events[LR11XX_HW_API_VIRTUAL_TIME_EVENTS];
+} LR11XX_HW_API_VIRTUAL_TIME_context_t;
+
+/*** LR11XX HW API VIRTUAL TIME local global variables ***/
+
+static LR11XX_HW_API_VIRTUAL_TIME_context_t lr11xx_virtual_time_ctx;
+
+/*** LR11XX HW API VIRTUAL TIME local functions ***/
+
+/*******************************************************************/
+static sfx_bool _lr11xx_virtual_time_expire_next(uint64_t end_time_us) {
+    LR11XX_HW_API_VIRTUAL_TIME_event_context_t *next_event = SIGFOX_NULL;
+    sfx_u8 idx = 0;
+    // Earliest pending event, the lowest identifier first on equal expiry times.
+    for (idx = 0; idx < LR11XX_HW_API_VIRTUAL_TIME_EVENTS; idx++) {
+        if ((lr11xx_virtual_time_ctx.events[idx].pending == SIGFOX_TRUE) && (lr11xx_virtual_time_ctx.events[idx].expiry_time_us <= end_time_us) &&
+            ((next_event == SIGFOX_NULL) || (lr11xx_virtual_time_ctx.events[idx].expiry_time_us < next_event->expiry_time_us))) {
+            next_event = &(lr11xx_virtual_time_ctx.events[idx]);
+        }
+    }
+    if (next_event == SIGFOX_NULL) {
+        return SIGFOX_FALSE;
+    }
+    if (next_event->expiry_time_us > lr11xx_virtual_time_ctx.time_us) {
+        lr11xx_virtual_time_ctx.time_us = next_event->expiry_time_us;
+    }
+    // The callback may schedule the same event again.
+    next_event->pending = SIGFOX_FALSE;
+    if (next_event->event_cb != SIGFOX_NULL) {
+        next_event->event_cb();
+    }
+    return SIGFOX_TRUE;
+}
+
+/*** LR11XX HW API VIRTUAL TIME functions ***/
+
+/*******************************************************************/
+void LR11XX_HW_API_VIRTUAL_TIME_reset(void) {
+    sfx_u8 idx = 0;
+    lr11xx_virtual_time_ctx.time_us = 0;
+    for (idx = 0; idx < LR11XX_HW_API_VIRTUAL_TIME_EVENTS; idx++) {
+        lr11xx_virtual_time_ctx.events[idx].pending = SIGFOX_FALSE;
+    }
+}
+
+/*******************************************************************/
+void LR11XX_HW_API_VIRTUAL_TIME_open(const LR11XX_HW_API_config_t *hw_api_config) {
+    lr11xx_virtual_time_ctx.gpio_irq_callback = hw_api_config->gpio_irq_callback;
+#if ((defined LR11XX_RF_API_SWEEP) || (defined LR11XX_RF_API_SPECTRUM_SCAN)) && (defined SIGFOX_EP_ASYNCHRONOUS)
+    lr11xx_virtual_time_ctx.timer_irq_callback = hw_api_config->timer_irq_callback;
+#endif
+}
+
+/*******************************************************************/
+uint64_t LR11XX_HW_API_VIRTUAL_TIME_get_time_us(void) {
+    return lr11xx_virtual_time_ctx.time_us;
+}
+
+/*******************************************************************/
+void LR11XX_HW_API_VIRTUAL_TIME_set_event(sfx_u8 event_id, sfx_u32 delay_us, LR11XX_HW_API_irq_cb_t event_cb) {
+    if (event_id >= LR11XX_HW_API_VIRTUAL_TIME_EVENTS) {
+        return;
+    }
+    lr11xx_virtual_time_ctx.events[event_id].expiry_time_us = lr11xx_virtual_time_ctx.time_us + delay_us;
+    lr11xx_virtual_time_ctx.events[event_id].event_cb = event_cb;
+    lr11xx_virtual_time_ctx.events[event_id].pending = SIGFOX_TRUE;
+}
+
+/*******************************************************************/
+void LR11XX_HW_API_VIRTUAL_TIME_cancel_event(sfx_u8 event_id) {
+    if (event_id < LR11XX_HW_API_VIRTUAL_TIME_EVENTS) {
+        lr11xx_virtual_time_ctx.events[event_id].pending = SIGFOX_FALSE;
+    }
+}
+
+/*******************************************************************/
+sfx_bool LR11XX_HW_API_VIRTUAL_TIME_is_event_pending(sfx_u8 event_id) {
+    if (event_id >= LR11XX_HW_API_VIRTUAL_TIME_EVENTS) {
+        return SIGFOX_FALSE;
+    }
+    return lr11xx_virtual_time_ctx.events[event_id].pending;
+}
+
+/*******************************************************************/
+void LR11XX_HW_API_VIRTUAL_TIME_raise_irq(sfx_u32 delay_us) {
+    LR11XX_HW_API_VIRTUAL_TIME_set_event(LR11XX_HW_API_VIRTUAL_TIME_EVENT_GPIO_IRQ, delay_us, lr11xx_virtual_time_ctx.gpio_irq_callback);
+}
+
+/*******************************************************************/
+void LR11XX_HW_API_VIRTUAL_TIME_advance(sfx_u32 duration_us) {
+    uint64_t end_time_us = lr11xx_virtual_time_ctx.time_us + duration_us;
+    while (_lr11xx_virtual_time_expire_next(end_time_us) == SIGFOX_TRUE);
+    lr11xx_virtual_time_ctx.time_us = end_time_us;
+}
+
+/*******************************************************************/
+sfx_bool LR11XX_HW_API_VIRTUAL_TIME_run_next_event(void) {
+    return _lr11xx_virtual_time_expire_next(UINT64_MAX);
+}
+
+/*** LR11XX HW API functions ***/
+
+/*******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_delayMs(unsigned short delay_ms) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_SUCCESS;
+#endif
+    LR11XX_HW_API_VIRTUAL_TIME_advance((sfx_u32) delay_ms * 1000);
+    SIGFOX_RETURN();
+}
+
+#if (defined LR11XX_RF_API_SHARED_BUS) || (defined LR11XX_RF_API_FLIGHT_RECORDER)
+/*******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_get_timestamp_us(sfx_u32 *timestamp_us) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_SUCCESS;
+#endif
+    (*timestamp_us) = (sfx_u32) lr11xx_virtual_time_ctx.time_us;
+    SIGFOX_RETURN();
+}
+#endif
+
+#if ((defined LR11XX_RF_API_SWEEP) || (defined LR11XX_RF_API_SPECTRUM_SCAN)) && (defined SIGFOX_EP_ASYNCHRONOUS)
+/*******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_timer_start(sfx_u32 duration_ms) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_SUCCESS;
+#endif
+    LR11XX_HW_API_VIRTUAL_TIME_set_event(LR11XX_HW_API_VIRTUAL_TIME_EVENT_TIMER_IRQ, duration_ms * 1000, lr11xx_virtual_time_ctx.timer_irq_callback);
+    SIGFOX_RETURN();
+}
+#endif
+
+#if ((defined LR11XX_RF_API_SWEEP) || (defined LR11XX_RF_API_SPECTRUM_SCAN)) && (defined SIGFOX_EP_ASYNCHRONOUS)
+/*******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_timer_stop(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_SUCCESS;
+#endif
+    LR11XX_HW_API_VIRTUAL_TIME_cancel_event(LR11XX_HW_API_VIRTUAL_TIME_EVENT_TIMER_IRQ);
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+/*******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_wait_irq(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_SUCCESS;
+#endif
+    // Jump to the next simulated event instead of busy waiting.
+    if (_lr11xx_virtual_time_expire_next(UINT64_MAX) == SIGFOX_FALSE) {
+        // Nothing can raise the IRQ anymore.
+        SIGFOX_EXIT_ERROR(LR11XX_HW_API_ERROR);
+    }
+    SIGFOX_RETURN();
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#endif /* LR11XX_HW_API_VIRTUAL_TIME */
@@ -0,0 +1,106 @@
+/*!*****************************************************************
+ * \file    lr11xx_mcu_api_virtual_time.c
+ * \brief   MCU API timers on the LR11XX HW API virtual time, for host simulation.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2024, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_error.h"
+#include "sigfox_types.h"
+#include "board/lr11xx_hw_api_virtual_time.h"
+#include "manuf/mcu_api.h"
+
+#if (defined LR11XX_HW_API_VIRTUAL_TIME_MCU_API) && (defined SIGFOX_EP_TIMER_REQUIRED)
+
+/*** LR11XX MCU API VIRTUAL TIME local macros ***/
+
+#define LR11XX_MCU_API_VIRTUAL_TIME_EVENT(timer_instance) ((sfx_u8) (LR11XX_HW_API_VIRTUAL_TIME_EVENT_MCU_TIMER + (timer_instance)))
+
+/*** MCU API functions ***/
+
+/*******************************************************************/
+MCU_API_status_t MCU_API_timer_start(MCU_API_timer_t *timer) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    MCU_API_status_t status = MCU_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    LR11XX_HW_API_VIRTUAL_TIME_set_event(LR11XX_MCU_API_VIRTUAL_TIME_EVENT(timer->instance), (timer->duration_ms * 1000), timer->cplt_cb);
+#else
+    LR11XX_HW_API_VIRTUAL_TIME_set_event(LR11XX_MCU_API_VIRTUAL_TIME_EVENT(timer->instance), (timer->duration_ms * 1000), SIGFOX_NULL);
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+MCU_API_status_t MCU_API_timer_stop(MCU_API_timer_instance_t timer_instance) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    MCU_API_status_t status = MCU_API_SUCCESS;
+#endif
+    LR11XX_HW_API_VIRTUAL_TIME_cancel_event(LR11XX_MCU_API_VIRTUAL_TIME_EVENT(timer_instance));
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+MCU_API_status_t MCU_API_timer_status(MCU_API_timer_instance_t timer_instance, sfx_bool *timer_has_elapsed) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    MCU_API_status_t status = MCU_API_SUCCESS;
+#endif
+    sfx_u8 event_id = LR11XX_MCU_API_VIRTUAL_TIME_EVENT(timer_instance);
+    // Polling loops progress by one simulated event per call. A timer which has not been started is reported as elapsed.
+    if (LR11XX_HW_API_VIRTUAL_TIME_is_event_pending(event_id) == SIGFOX_TRUE) {
+        LR11XX_HW_API_VIRTUAL_TIME_run_next_event();
+    }
+    (*timer_has_elapsed) = (LR11XX_HW_API_VIRTUAL_TIME_is_event_pending(event_id) == SIGFOX_TRUE) ? SIGFOX_FALSE : SIGFOX_TRUE;
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+MCU_API_status_t MCU_API_timer_wait_cplt(MCU_API_timer_instance_t timer_instance) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    MCU_API_status_t status = MCU_API_SUCCESS;
+#endif
+    sfx_u8 event_id = LR11XX_MCU_API_VIRTUAL_TIME_EVENT(timer_instance);
+    while (LR11XX_HW_API_VIRTUAL_TIME_is_event_pending(event_id) == SIGFOX_TRUE) {
+        if (LR11XX_HW_API_VIRTUAL_TIME_run_next_event() == SIGFOX_FALSE) {
+            // No event left to expire: the timer can not complete.
+            SIGFOX_EXIT_ERROR(MCU_API_ERROR);
+        }
+    }
+    SIGFOX_RETURN();
+errors:
+    SIGFOX_RETURN();
+}
+
+#endif /* LR11XX_HW_API_VIRTUAL_TIME_MCU_API && SIGFOX_EP_TIMER_REQUIRED */
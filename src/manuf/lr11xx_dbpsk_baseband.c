@@ -0,0 +1,249 @@
+/*!*****************************************************************
+ * \file    lr11xx_dbpsk_baseband.c
+ * \brief   DBPSK I/Q baseband generator and demodulator for host simulation.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2024, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include "manuf/lr11xx_dbpsk_baseband.h"
+
+#include "lr11xx_radio_types.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*** LR11XX DBPSK BASEBAND local macros ***/
+
+#define LR11XX_DBPSK_BASEBAND_PI 3.14159265358979323846f
+
+/*** LR11XX DBPSK BASEBAND local functions ***/
+
+/*******************************************************************/
+static float _get_sign(const uint8_t *buffer, uint32_t bit_index) {
+    // Phase 0 is transmitted with a positive amplitude.
+    return (((buffer[bit_index >> 3] >> (7 - (bit_index & 7))) & 0x01) == 0) ? 1.0f : -1.0f;
+}
+
+/*******************************************************************/
+static void _copy_shape(const LR11XX_DBPSK_BASEBAND_iq_t *shape, float sign, LR11XX_DBPSK_BASEBAND_iq_t *iq_out, uint32_t sample_count) {
+    uint32_t idx = 0;
+    for (idx = 0; idx < sample_count; idx++) {
+        iq_out[idx].i = sign * shape[idx].i;
+        iq_out[idx].q = sign * shape[idx].q;
+    }
+}
+
+/*******************************************************************/
+static void _fill_carrier(const LR11XX_DBPSK_BASEBAND_t *baseband, float sign, LR11XX_DBPSK_BASEBAND_iq_t *iq_out, uint32_t sample_count) {
+    float i = sign * baseband->carrier.i;
+    float q = sign * baseband->carrier.q;
+    uint32_t idx = 0;
+    for (idx = 0; idx < sample_count; idx++) {
+        iq_out[idx].i = i;
+        iq_out[idx].q = q;
+    }
+}
+
+/*******************************************************************/
+static LR11XX_DBPSK_BASEBAND_status_t _compute_ramp(const LR11XX_DBPSK_BASEBAND_t *baseband, uint16_t delay_us, uint8_t ramp_down, LR11XX_DBPSK_BASEBAND_iq_t *ramp, uint16_t *ramp_len_in_samples) {
+    uint64_t len = 0;
+    float envelope = 0;
+    uint32_t idx = 0;
+    // Ramp duration converted to samples, rounded to the nearest sample.
+    len = ((((uint64_t) delay_us) * ((uint64_t) baseband->bit_rate_bps) * ((uint64_t) baseband->oversampling)) + 500000) / 1000000;
+    if (len > (2 * ((uint64_t) baseband->oversampling))) {
+        return LR11XX_DBPSK_BASEBAND_ERROR_PKT_PARAMS;
+    }
+    for (idx = 0; idx < len; idx++) {
+        envelope = 0.5f * (1.0f - cosf((LR11XX_DBPSK_BASEBAND_PI * ((float) idx + 0.5f)) / (float) len));
+        if (ramp_down != 0) {
+            envelope = 1.0f - envelope;
+        }
+        ramp[idx].i = envelope * baseband->carrier.i;
+        ramp[idx].q = envelope * baseband->carrier.q;
+    }
+    (*ramp_len_in_samples) = (uint16_t) len;
+    return LR11XX_DBPSK_BASEBAND_SUCCESS;
+}
+
+/*** LR11XX DBPSK BASEBAND functions ***/
+
+/*******************************************************************/
+LR11XX_DBPSK_BASEBAND_status_t LR11XX_DBPSK_BASEBAND_init(LR11XX_DBPSK_BASEBAND_t *baseband, uint32_t bit_rate_bps, uint16_t oversampling, float carrier_phase_rad) {
+    float amplitude = 0;
+    uint16_t idx = 0;
+    if (baseband == NULL) {
+        return LR11XX_DBPSK_BASEBAND_ERROR_NULL_PARAMETER;
+    }
+    if (bit_rate_bps == 0) {
+        return LR11XX_DBPSK_BASEBAND_ERROR_BIT_RATE;
+    }
+    if ((oversampling < LR11XX_DBPSK_BASEBAND_OVERSAMPLING_MIN) || (oversampling > LR11XX_DBPSK_BASEBAND_OVERSAMPLING_MAX)) {
+        return LR11XX_DBPSK_BASEBAND_ERROR_OVERSAMPLING;
+    }
+    baseband->bit_rate_bps = bit_rate_bps;
+    baseband->oversampling = oversampling;
+    baseband->carrier.i = cosf(carrier_phase_rad);
+    baseband->carrier.q = sinf(carrier_phase_rad);
+    // The amplitude crosses zero in the middle of the bit.
+    for (idx = 0; idx < oversampling; idx++) {
+        amplitude = cosf((LR11XX_DBPSK_BASEBAND_PI * ((float) idx + 0.5f)) / (float) oversampling);
+        baseband->transition[idx].i = amplitude * baseband->carrier.i;
+        baseband->transition[idx].q = amplitude * baseband->carrier.q;
+    }
+    // No packet parameters yet.
+    baseband->ramp_up_delay_us = 0;
+    baseband->ramp_down_delay_us = 0;
+    baseband->ramp_up_len_in_samples = 0;
+    baseband->ramp_down_len_in_samples = 0;
+    baseband->pld_len_in_bits = 0;
+    return LR11XX_DBPSK_BASEBAND_SUCCESS;
+}
+
+/*******************************************************************/
+LR11XX_DBPSK_BASEBAND_status_t LR11XX_DBPSK_BASEBAND_set_pkt_params(LR11XX_DBPSK_BASEBAND_t *baseband, const lr11xx_radio_pkt_params_bpsk_t *pkt_params) {
+    LR11XX_DBPSK_BASEBAND_status_t status = LR11XX_DBPSK_BASEBAND_SUCCESS;
+    if ((baseband == NULL) || (pkt_params == NULL)) {
+        return LR11XX_DBPSK_BASEBAND_ERROR_NULL_PARAMETER;
+    }
+    // The buffer must hold the payload bits.
+    if ((pkt_params->pld_len_in_bits < 2) || (pkt_params->pld_len_in_bits > (((uint16_t) pkt_params->pld_len_in_bytes) << 3))) {
+        return LR11XX_DBPSK_BASEBAND_ERROR_PKT_PARAMS;
+    }
+    if ((baseband->ramp_up_len_in_samples == 0) || (pkt_params->ramp_up_delay != baseband->ramp_up_delay_us)) {
+        status = _compute_ramp(baseband, pkt_params->ramp_up_delay, 0, baseband->ramp_up, &(baseband->ramp_up_len_in_samples));
+        if (status != LR11XX_DBPSK_BASEBAND_SUCCESS) {
+            return status;
+        }
+        baseband->ramp_up_delay_us = pkt_params->ramp_up_delay;
+    }
+    if ((baseband->ramp_down_len_in_samples == 0) || (pkt_params->ramp_down_delay != baseband->ramp_down_delay_us)) {
+        status = _compute_ramp(baseband, pkt_params->ramp_down_delay, 1, baseband->ramp_down, &(baseband->ramp_down_len_in_samples));
+        if (status != LR11XX_DBPSK_BASEBAND_SUCCESS) {
+            return status;
+        }
+        baseband->ramp_down_delay_us = pkt_params->ramp_down_delay;
+    }
+    baseband->pld_len_in_bits = pkt_params->pld_len_in_bits;
+    return LR11XX_DBPSK_BASEBAND_SUCCESS;
+}
+
+/*******************************************************************/
+uint32_t LR11XX_DBPSK_BASEBAND_get_len_in_samples(const LR11XX_DBPSK_BASEBAND_t *baseband) {
+    return ((uint32_t) baseband->ramp_up_len_in_samples) + (((uint32_t) baseband->pld_len_in_bits) * ((uint32_t) baseband->oversampling)) + ((uint32_t) baseband->ramp_down_len_in_samples);
+}
+
+/*******************************************************************/
+uint32_t LR11XX_DBPSK_BASEBAND_modulate(const LR11XX_DBPSK_BASEBAND_t *baseband, const uint8_t *buffer, uint32_t first_sample, LR11XX_DBPSK_BASEBAND_iq_t *iq_out, uint32_t sample_count) {
+    uint32_t bits_start = baseband->ramp_up_len_in_samples;
+    uint32_t bits_end = bits_start + (((uint32_t) baseband->pld_len_in_bits) * ((uint32_t) baseband->oversampling));
+    uint32_t frame_end = bits_end + baseband->ramp_down_len_in_samples;
+    uint32_t sample = first_sample;
+    uint32_t block_end = 0;
+    uint32_t segment_end = 0;
+    uint32_t bit_index = 0;
+    uint32_t bit_offset = 0;
+    float sign = 0;
+    float previous_sign = 0;
+    if (first_sample >= frame_end) {
+        return 0;
+    }
+    block_end = ((frame_end - first_sample) < sample_count) ? frame_end : (first_sample + sample_count);
+    // Samples are generated by segments which use a single pulse shape: ramp-up, bits and ramp-down.
+    while (sample < block_end) {
+        if (sample < bits_start) {
+            segment_end = (bits_start < block_end) ? bits_start : block_end;
+            _copy_shape(&(baseband->ramp_up[sample]), _get_sign(buffer, 0), iq_out, segment_end - sample);
+        }
+        else if (sample < bits_end) {
+            bit_index = (sample - bits_start) / baseband->oversampling;
+            bit_offset = (sample - bits_start) % baseband->oversampling;
+            segment_end = bits_start + ((bit_index + 1) * baseband->oversampling);
+            segment_end = (segment_end < block_end) ? segment_end : block_end;
+            sign = _get_sign(buffer, bit_index);
+            previous_sign = (bit_index == 0) ? sign : _get_sign(buffer, bit_index - 1);
+            if (sign == previous_sign) {
+                _fill_carrier(baseband, sign, iq_out, segment_end - sample);
+            }
+            else {
+                _copy_shape(&(baseband->transition[bit_offset]), previous_sign, iq_out, segment_end - sample);
+            }
+        }
+        else {
+            segment_end = block_end;
+            _copy_shape(&(baseband->ramp_down[sample - bits_end]), _get_sign(buffer, baseband->pld_len_in_bits - 1), iq_out, segment_end - sample);
+        }
+        iq_out += (segment_end - sample);
+        sample = segment_end;
+    }
+    return (block_end - first_sample);
+}
+
+/*******************************************************************/
+void LR11XX_DBPSK_BASEBAND_demodulate(const LR11XX_DBPSK_BASEBAND_t *baseband, const LR11XX_DBPSK_BASEBAND_iq_t *iq_in, uint8_t *data_out) {
+    const LR11XX_DBPSK_BASEBAND_iq_t *bit_iq = NULL;
+    LR11XX_DBPSK_BASEBAND_iq_t start;
+    LR11XX_DBPSK_BASEBAND_iq_t end;
+    uint16_t quarter_len = (baseband->oversampling >> 2);
+    uint16_t bit_index = 0;
+    uint16_t idx = 0;
+    uint8_t out_byte = 0;
+    if (baseband->pld_len_in_bits < 2) {
+        return;
+    }
+    // The phase changes during bit n + 1 when bit n of the data is 0.
+    bit_iq = &(iq_in[baseband->ramp_up_len_in_samples + baseband->oversampling]);
+    for (bit_index = 0; bit_index < (baseband->pld_len_in_bits - 2); bit_index++) {
+        start.i = 0;
+        start.q = 0;
+        end.i = 0;
+        end.q = 0;
+        for (idx = 0; idx < quarter_len; idx++) {
+            start.i += bit_iq[idx].i;
+            start.q += bit_iq[idx].q;
+            end.i += bit_iq[baseband->oversampling - quarter_len + idx].i;
+            end.q += bit_iq[baseband->oversampling - quarter_len + idx].q;
+        }
+        // Real part of end * conj(start).
+        out_byte = (uint8_t) ((out_byte << 1) | ((((end.i * start.i) + (end.q * start.q)) < 0) ? 0x00 : 0x01));
+        if ((bit_index & 7) == 7) {
+            data_out[bit_index >> 3] = out_byte;
+            out_byte = 0;
+        }
+        bit_iq += baseband->oversampling;
+    }
+    // Last bits left aligned.
+    if ((bit_index & 7) != 0) {
+        data_out[bit_index >> 3] = (uint8_t) (out_byte << (8 - (bit_index & 7)));
+    }
+}
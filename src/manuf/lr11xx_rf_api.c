@@ -39,6 +39,9 @@
 #include "manuf/mcu_api.h"
 #include "sigfox_error.h"
 #include "board/lr11xx_hw_api.h"
+#ifdef LR11XX_HW_API_STATIC_CONFIG
+#include "lr11xx_board_config.h"
+#endif
 #include "lr11xx_system.h"
 #include "lr11xx_radio_types.h"
 #include "lr11xx_radio.h"
@@ -48,6 +51,74 @@
 #define T_RADIO_BIT_LATENCY_ON (2)
 #define T_RADIO_BIT_LATENCY_OFF (9)
 
+#ifdef LR11XX_RF_API_RC_PROFILES
+// PA configuration is assumed constant within this band: it is cached per band and TX power.
+#define LR11XX_RF_API_PA_PWR_CFG_BAND_HZ 1000000
+#endif
+
+// Margin added to the uplink airtime to build the TX watchdog (PA ramp and chip state transitions).
+#define LR11XX_RF_API_TX_TIMEOUT_MARGIN_MS 50
+#define LR11XX_RF_API_DL_PREAMBLE_SIZE_BITS 16
+
+#ifdef LR11XX_RF_API_POWER_POLICY
+// Restarting the oscillator costs about as much as keeping it running during its startup time:
+// a low power mode is only selected if the gap is at least twice its exit time, which also guarantees the next frame deadline.
+#define LR11XX_RF_API_POWER_POLICY_GAP_FACTOR 2
+#endif
+
+#ifdef LR11XX_RF_API_ADAPTIVE_TX_POWER
+#define LR11XX_RF_API_ADAPTIVE_TX_POWER_BANDS 4
+// Default policy: downlink RSSI which still gives a comfortable margin above the GFSK sensitivity (about -126 dBm).
+#define LR11XX_RF_API_ADAPTIVE_TX_POWER_TARGET_RSSI_DBM (-110)
+#define LR11XX_RF_API_ADAPTIVE_TX_POWER_REDUCTION_MAX_DB 10
+// The reduction is only increased when the suggestion exceeds the applied one by this value, and decreased as soon as it is lower.
+#define LR11XX_RF_API_ADAPTIVE_TX_POWER_HYSTERESIS_DB 3
+#endif
+
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+#define LR11XX_RF_API_FLIGHT_RECORDER_MAGIC 0x4C524652
+// Deltas above this value are stored in units of 1024 us.
+#define LR11XX_RF_API_FLIGHT_RECORDER_DELTA_MAX 0x7FFF
+#define LR11XX_RF_API_FLIGHT_RECORDER_DELTA_COARSE 0x8000
+#ifdef SIGFOX_EP_ERROR_CODES
+#define LR11XX_RF_API_FLIGHT_RECORD_EXIT(function) _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_EXIT, (function), (sfx_u32) status)
+#else
+#define LR11XX_RF_API_FLIGHT_RECORD_EXIT(function) _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_EXIT, (function), 0)
+#endif
+#endif
+
+// Bits encoded after the bitstream to close the frame.
+#define LR11XX_RF_API_DBPSK_TAIL_BYTE 0x80
+#define LR11XX_RF_API_DBPSK_TAIL_SIZE_BITS 2
+
+#ifdef LR11XX_RF_API_RTC_WAIT
+#define LR11XX_RF_API_RTC_FREQUENCY_HZ 32768
+// Sleep time is a 32-bit number of RTC steps.
+#define LR11XX_RF_API_RTC_WAIT_DURATION_MAX_MS ((0xFFFFFFFFUL / LR11XX_RF_API_RTC_FREQUENCY_HZ) * 1000)
+#endif
+
+#ifdef LR11XX_RF_API_SWEEP
+#define LR11XX_RF_API_SWEEP_PATTERN_SIZE_BYTES 12
+#define LR11XX_RF_API_SWEEP_DELAY_MAX_MS 0xFFFF
+#endif
+
+#ifdef LR11XX_RF_API_ASYNC_HAL
+// Radio buffer commands, sent directly to the board so that they can be completed asynchronously.
+#define LR11XX_RF_API_WRITE_BUFFER8_OPCODE 0x0109
+#define LR11XX_RF_API_READ_BUFFER8_OPCODE 0x010A
+// Command sizes: opcode only for the write, opcode followed by the offset and the length for the read.
+#define LR11XX_RF_API_OPCODE_SIZE_BYTES 2
+#define LR11XX_RF_API_WRITE_BUFFER8_CMD_SIZE_BYTES LR11XX_RF_API_OPCODE_SIZE_BYTES
+#define LR11XX_RF_API_READ_BUFFER8_CMD_SIZE_BYTES (LR11XX_RF_API_OPCODE_SIZE_BYTES + 2)
+#define LR11XX_RF_API_HAL_COMMAND_SIZE_BYTES LR11XX_RF_API_READ_BUFFER8_CMD_SIZE_BYTES
+#endif
+
+#ifdef LR11XX_RF_API_SPECTRUM_SCAN
+// Downlink modulation, so that the RSSI is measured in the bandwidth of a downlink channel.
+#define LR11XX_RF_API_SCAN_BIT_RATE_BPS 600
+#define LR11XX_RF_API_SCAN_DEVIATION_HZ 800
+#endif
+
 #ifdef SIGFOX_EP_ASYNCHRONOUS
 typedef struct {
     RF_API_process_cb_t process_cb;
@@ -62,6 +133,42 @@ typedef struct {
 } callback_t;
 #endif
 
+#ifdef LR11XX_RF_API_RC_PROFILES
+typedef struct {
+    const SIGFOX_rc_t *rc;
+    lr11xx_system_rfswitch_cfg_t rf_switch_cfg;
+    LR11XX_HW_API_xosc_cfg_t xosc_cfg;
+    // Image rejection is calibrated once for all the uplink and downlink frequencies of the RC.
+    sfx_u16 image_calib_freq1_mhz;
+    sfx_u16 image_calib_freq2_mhz;
+    sfx_bool pa_pwr_cfg_valid;
+    sfx_u32 pa_band;
+    sfx_s8 pa_tx_power_dbm_eirp;
+    LR11XX_HW_API_pa_pwr_cfg_t pa_pwr_cfg;
+} rc_profile_t;
+#endif
+
+typedef struct {
+    sfx_bool gnss_wifi; // GNSS and Wi-Fi scan paths.
+    sfx_bool hf_pa; // High frequency (2.4 GHz) power amplifier.
+} chip_variant_profile_t;
+
+#ifdef LR11XX_RF_API_ERROR_RECOVERY
+typedef enum {
+    RADIO_CMD_NONE = 0,
+    RADIO_CMD_TX,
+    RADIO_CMD_RX
+} radio_cmd_t;
+#endif
+
+#ifdef LR11XX_RF_API_ASYNC_HAL
+typedef enum {
+    HAL_OPERATION_NONE = 0,
+    HAL_OPERATION_WRITE_TX_BUFFER,
+    HAL_OPERATION_READ_RX_BUFFER
+} hal_operation_t;
+#endif
+
 typedef struct {
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     callback_t callbacks;
@@ -72,12 +179,150 @@ typedef struct {
     volatile sfx_bool irq_flag;
     volatile sfx_bool irq_en;
     sfx_u16 backup_bit_rate_bps_patch;
+    sfx_u32 tx_timeout_ms;
+    sfx_bool chip_configured;
+    LR11XX_RF_API_chip_variant_t chip_variant;
+#ifdef LR11XX_RF_API_COEXISTENCE
+    sfx_bool sigfox_active;
+    sfx_bool coex_pending;
+    LR11XX_RF_API_coex_owner_t coex_owner;
+    LR11XX_RF_API_coex_granted_cb_t coex_granted_cb;
+#endif
+#ifdef LR11XX_RF_API_RC_PROFILES
+    rc_profile_t rc_profiles[LR11XX_RF_API_RC_PROFILES];
+    sfx_u8 rc_profile_index;
+    lr11xx_system_rfswitch_cfg_t applied_rf_switch_cfg;
+    LR11XX_HW_API_xosc_cfg_t applied_xosc_cfg;
+    sfx_u16 applied_image_calib_freq1_mhz;
+    sfx_u16 applied_image_calib_freq2_mhz;
+#endif
+#ifdef LR11XX_RF_API_ERROR_RECOVERY
+    LR11XX_RF_API_recovery_info_t recovery_info;
+    radio_cmd_t radio_cmd;
+    sfx_bool recovered;
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    sfx_bool bus_acquired;
+    sfx_u32 bus_acquire_timestamp_us;
+    LR11XX_RF_API_bus_stats_t bus_stats;
+#endif
+#ifdef LR11XX_RF_API_POWER_POLICY
+    sfx_u32 gap_hint_ms;
+    LR11XX_RF_API_gap_mode_t gap_mode;
+#endif
+#ifdef LR11XX_RF_API_REG_MODE_POLICY
+#ifndef LR11XX_HW_API_STATIC_CONFIG
+    LR11XX_HW_API_reg_mode_cfg_t reg_mode_cfg;
+#endif
+    lr11xx_system_reg_mode_t reg_mode;
+#endif
+#ifdef LR11XX_RF_API_STATISTICS
+    LR11XX_RF_API_stats_t stats;
+    LR11XX_RF_API_function_t stats_function;
+#endif
+#ifdef LR11XX_RF_API_ADAPTIVE_TX_POWER
+    LR11XX_RF_API_rssi_history_t rssi_history[LR11XX_RF_API_ADAPTIVE_TX_POWER_BANDS];
+    sfx_u8 rssi_history_next_band;
+    LR11XX_RF_API_tx_power_policy_cb_t tx_power_policy_cb;
+    sfx_u32 ul_frequency_hz;
+    sfx_s8 ul_tx_power_dbm_eirp;
+    sfx_bool dl_expected;
+#endif
+#ifdef LR11XX_RF_API_RTC_WAIT
+    sfx_bool rtc_wait_started;
+    volatile sfx_bool rtc_wait_running;
+    sfx_bool rtc_wait_asleep;
+    sfx_bool rtc_wait_irq_en;
+    LR11XX_RF_API_rtc_wait_cplt_cb_t rtc_wait_cplt_cb;
+#endif
+#if (defined SIGFOX_EP_BIDIRECTIONAL) && (defined LR11XX_RF_API_DL_VALIDATION)
+    LR11XX_RF_API_dl_validation_cb_t dl_validation_cb;
+    sfx_u32 dl_rejected_count;
+#endif
+#ifdef LR11XX_RF_API_BULK_MODE
+    sfx_bool bulk_session;
+    sfx_bool bulk_awake;
+    sfx_bool bulk_radio_valid;
+    RF_API_radio_parameters_t bulk_radio_parameters;
+#endif
+#ifdef LR11XX_RF_API_SWEEP
+    LR11XX_RF_API_sweep_config_t sweep_config;
+    sfx_u16 sweep_point_index;
+    sfx_u32 sweep_frame_count;
+    sfx_bool sweep_running;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    volatile sfx_bool sweep_timer_flag;
+#endif
+#endif
+#ifdef LR11XX_RF_API_SPECTRUM_SCAN
+    LR11XX_RF_API_scan_config_t scan_config;
+    sfx_u16 scan_channel_index;
+    sfx_u32 scan_samples_per_channel;
+    sfx_u32 scan_sample_count;
+    sfx_s32 scan_rssi_sum;
+    sfx_s16 scan_rssi_min;
+    sfx_s16 scan_rssi_max;
+    sfx_bool scan_running;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    volatile sfx_bool scan_timer_flag;
+#endif
+#endif
+#ifdef LR11XX_RF_API_ASYNC_HAL
+    hal_operation_t hal_operation;
+    volatile sfx_bool hal_cplt_flag;
+    sfx_u8 hal_command[LR11XX_RF_API_HAL_COMMAND_SIZE_BYTES];
+#ifndef LR11XX_RF_API_HAL_TX_BUFFER
+    sfx_u8 tx_buffer[SIGFOX_UL_BITSTREAM_SIZE_BYTES + 1];
+#endif
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    sfx_u8 dl_phy_content[SIGFOX_DL_PHY_CONTENT_SIZE_BYTES];
+#endif
+#endif
 } lr1110_ctx_t;
 
 #ifdef SIGFOX_EP_VERBOSE
 static const sfx_u8 LR11XX_RF_API_VERSION[] = "v3.1";
 #endif
 
+static const chip_variant_profile_t LR11XX_RF_API_CHIP_VARIANT_PROFILE[LR11XX_RF_API_CHIP_VARIANT_LAST] = {
+    { .gnss_wifi = SIGFOX_FALSE, .hf_pa = SIGFOX_FALSE }, // Unknown.
+    { .gnss_wifi = SIGFOX_TRUE, .hf_pa = SIGFOX_FALSE }, // LR1110.
+    { .gnss_wifi = SIGFOX_TRUE, .hf_pa = SIGFOX_TRUE }, // LR1120.
+    { .gnss_wifi = SIGFOX_FALSE, .hf_pa = SIGFOX_TRUE }, // LR1121.
+};
+
+#ifdef LR11XX_RF_API_SWEEP
+static const sfx_u8 LR11XX_RF_API_SWEEP_PATTERN[LR11XX_RF_API_SWEEP_PATTERN_SIZE_BYTES] = { 0xAA, 0xAA, 0xA0, 0x8F, 0x1F, 0x00, 0xFF, 0x55, 0xCC, 0x33, 0xF0, 0x0F };
+#endif
+
+#ifdef LR11XX_HW_API_STATIC_CONFIG
+// Board settings generated from the board descriptor.
+static const lr11xx_system_rfswitch_cfg_t LR11XX_RF_API_RF_SWITCH_CFG = {
+    .enable = LR11XX_BOARD_FEM_PIN_USED,
+    .standby = LR11XX_BOARD_FEM_STBY,
+    .rx = LR11XX_BOARD_FEM_RX,
+    .tx = LR11XX_BOARD_FEM_TX,
+    .tx_hp = LR11XX_BOARD_FEM_TXHP,
+    .tx_hf = 0,
+    .gnss = LR11XX_BOARD_FEM_GNSS,
+    .wifi = LR11XX_BOARD_FEM_WIFI,
+};
+static const LR11XX_HW_API_xosc_cfg_t LR11XX_RF_API_XOSC_CFG = {
+    .has_tcxo = LR11XX_BOARD_XOSC_HAS_TCXO,
+    .tcxo_supply_voltage = LR11XX_BOARD_XOSC_TCXO_SUPPLY_VOLTAGE,
+    .startup_time_in_tick = LR11XX_BOARD_XOSC_STARTUP_TIME_IN_TICK,
+};
+static const LR11XX_HW_API_pa_pwr_table_entry_t LR11XX_RF_API_PA_PWR_TABLE[] = LR11XX_BOARD_PA_PWR_TABLE;
+static const LR11XX_HW_API_pa_pwr_band_t LR11XX_RF_API_PA_PWR_BANDS[] = LR11XX_BOARD_PA_PWR_BANDS;
+#ifdef LR11XX_RF_API_REG_MODE_POLICY
+static const LR11XX_HW_API_reg_mode_cfg_t LR11XX_RF_API_REG_MODE_CFG = {
+    .has_dcdc = LR11XX_BOARD_REG_MODE_HAS_DCDC,
+    .rx_dcdc = LR11XX_BOARD_REG_MODE_RX_DCDC,
+};
+#endif
+#define LR11XX_RF_API_PA_PWR_BANDS_SIZE (sizeof(LR11XX_RF_API_PA_PWR_BANDS) / sizeof(LR11XX_HW_API_pa_pwr_band_t))
+#endif
+
 static lr1110_ctx_t lr1110_ctx = {
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     .callbacks.process_cb = SIGFOX_NULL,
@@ -95,12 +340,120 @@ static lr1110_ctx_t lr1110_ctx = {
     .error_flag = 0,
     .irq_flag = 0,
     .irq_en = SIGFOX_FALSE,
-    .backup_bit_rate_bps_patch = 0};
+    .backup_bit_rate_bps_patch = 0,
+    .tx_timeout_ms = 0,
+    .chip_configured = SIGFOX_FALSE,
+    .chip_variant = LR11XX_RF_API_CHIP_VARIANT_UNKNOWN,
+#ifdef LR11XX_RF_API_COEXISTENCE
+    .sigfox_active = SIGFOX_FALSE,
+    .coex_pending = SIGFOX_FALSE,
+    .coex_owner = LR11XX_RF_API_COEX_OWNER_NONE,
+    .coex_granted_cb = SIGFOX_NULL,
+#endif
+#ifdef LR11XX_RF_API_RC_PROFILES
+    .rc_profile_index = 0,
+    .applied_image_calib_freq1_mhz = 0,
+    .applied_image_calib_freq2_mhz = 0,
+#endif
+#ifdef LR11XX_RF_API_ERROR_RECOVERY
+    .recovery_info.last_fault = LR11XX_RF_API_FAULT_NONE,
+    .recovery_info.last_chip_errors = 0,
+    .recovery_info.consecutive_recovery_count = 0,
+    .recovery_info.recovery_count = 0,
+    .recovery_info.reset_count = 0,
+    .radio_cmd = RADIO_CMD_NONE,
+    .recovered = SIGFOX_FALSE,
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    .bus_acquired = SIGFOX_FALSE,
+    .bus_acquire_timestamp_us = 0,
+    .bus_stats.acquire_count = 0,
+    .bus_stats.hold_time_last_us = 0,
+    .bus_stats.hold_time_max_us = 0,
+    .bus_stats.hold_time_total_us = 0,
+#endif
+#ifdef LR11XX_RF_API_POWER_POLICY
+    .gap_hint_ms = 0,
+    .gap_mode = LR11XX_RF_API_GAP_MODE_STANDBY_XOSC,
+#endif
+#ifdef LR11XX_RF_API_REG_MODE_POLICY
+    .reg_mode = LR11XX_SYSTEM_REG_MODE_LDO,
+#endif
+#ifdef LR11XX_RF_API_STATISTICS
+    .stats_function = LR11XX_RF_API_FUNCTION_OTHER,
+#endif
+#ifdef LR11XX_RF_API_ADAPTIVE_TX_POWER
+    .rssi_history_next_band = 0,
+    .tx_power_policy_cb = SIGFOX_NULL,
+    .ul_frequency_hz = 0,
+    .ul_tx_power_dbm_eirp = 0,
+    .dl_expected = SIGFOX_FALSE,
+#endif
+#ifdef LR11XX_RF_API_RTC_WAIT
+    .rtc_wait_started = SIGFOX_FALSE,
+    .rtc_wait_running = SIGFOX_FALSE,
+    .rtc_wait_asleep = SIGFOX_FALSE,
+    .rtc_wait_irq_en = SIGFOX_FALSE,
+    .rtc_wait_cplt_cb = SIGFOX_NULL,
+#endif
+#if (defined SIGFOX_EP_BIDIRECTIONAL) && (defined LR11XX_RF_API_DL_VALIDATION)
+    .dl_validation_cb = SIGFOX_NULL,
+    .dl_rejected_count = 0,
+#endif
+#ifdef LR11XX_RF_API_BULK_MODE
+    .bulk_session = SIGFOX_FALSE,
+    .bulk_awake = SIGFOX_FALSE,
+    .bulk_radio_valid = SIGFOX_FALSE,
+#endif
+#ifdef LR11XX_RF_API_SWEEP
+    .sweep_point_index = 0,
+    .sweep_frame_count = 0,
+    .sweep_running = SIGFOX_FALSE,
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    .sweep_timer_flag = 0,
+#endif
+#endif
+#ifdef LR11XX_RF_API_SPECTRUM_SCAN
+    .scan_channel_index = 0,
+    .scan_samples_per_channel = 0,
+    .scan_sample_count = 0,
+    .scan_rssi_sum = 0,
+    .scan_rssi_min = 0,
+    .scan_rssi_max = 0,
+    .scan_running = SIGFOX_FALSE,
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    .scan_timer_flag = 0,
+#endif
+#endif
+#ifdef LR11XX_RF_API_ASYNC_HAL
+    .hal_operation = HAL_OPERATION_NONE,
+    .hal_cplt_flag = 0,
+#endif
+};
+
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+// Not initialized at startup so that the records survive a reset when the section is mapped in retention RAM.
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER_SECTION
+static LR11XX_RF_API_flight_recorder_t lr11xx_flight_recorder __attribute__((section(LR11XX_RF_API_FLIGHT_RECORDER_SECTION)));
+#else
+static LR11XX_RF_API_flight_recorder_t lr11xx_flight_recorder;
+#endif
+#endif
 
 /*** LR11XX RF API local functions ***/
 
 /*******************************************************************/
 static void _lr11xx_gpio_irq_callback(void) {
+#ifdef LR11XX_RF_API_RTC_WAIT
+    if (lr1110_ctx.rtc_wait_running == SIGFOX_TRUE) {
+        // Chip woke up at the end of the RTC wait (only the wake-up is routed here while the wait is running).
+        lr1110_ctx.rtc_wait_running = SIGFOX_FALSE;
+        if (lr1110_ctx.rtc_wait_cplt_cb != SIGFOX_NULL) {
+            lr1110_ctx.rtc_wait_cplt_cb();
+        }
+        return;
+    }
+#endif
     if (lr1110_ctx.irq_en == 1) {
         lr1110_ctx.irq_flag = 1;
 #ifdef SIGFOX_EP_ASYNCHRONOUS
@@ -109,246 +462,280 @@ static void _lr11xx_gpio_irq_callback(void) {
         }
 #endif
     }
+#ifdef LR11XX_RF_API_STATISTICS
+    else {
+        lr1110_ctx.stats.irq_spurious_count++;
+    }
+#endif
 }
 
-/*** LR11XX RF API functions ***/
-
-#if (defined SIGFOX_EP_ASYNCHRONOUS) || (defined SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE)
+#if ((defined LR11XX_RF_API_SWEEP) || (defined LR11XX_RF_API_SPECTRUM_SCAN)) && (defined SIGFOX_EP_ASYNCHRONOUS)
 /*******************************************************************/
-RF_API_status_t LR11XX_RF_API_open(RF_API_config_t *rf_api_config) {
-#ifdef SIGFOX_EP_ERROR_CODES
-    RF_API_status_t status = RF_API_SUCCESS;
-    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+static void _lr11xx_timer_callback(void) {
+    sfx_bool timer_used = SIGFOX_FALSE;
+#ifdef LR11XX_RF_API_SWEEP
+    if (lr1110_ctx.sweep_running == SIGFOX_TRUE) {
+        lr1110_ctx.sweep_timer_flag = 1;
+        timer_used = SIGFOX_TRUE;
+    }
 #endif
-    LR11XX_HW_API_config_t lr11xx_hw_api_config;
-#ifdef SIGFOX_EP_ASYNCHRONOUS
-    lr1110_ctx.callbacks.process_cb = rf_api_config->process_cb;
-    lr1110_ctx.callbacks.error_cb = rf_api_config->error_cb;
-#else
-    SIGFOX_UNUSED(rf_api_config);
+#ifdef LR11XX_RF_API_SPECTRUM_SCAN
+    if (lr1110_ctx.scan_running == SIGFOX_TRUE) {
+        lr1110_ctx.scan_timer_flag = 1;
+        timer_used = SIGFOX_TRUE;
+    }
 #endif
-    // Init board.
-    lr11xx_hw_api_config.rc = (rf_api_config->rc);
-    lr11xx_hw_api_config.gpio_irq_callback = &_lr11xx_gpio_irq_callback;
-#ifdef SIGFOX_EP_ERROR_CODES
-    LR11XX_HW_API_open(&lr11xx_hw_api_config);
-    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
-#else
-    LR11XX_HW_API_open(&lr11xx_hw_api_config);
+    if ((timer_used == SIGFOX_TRUE) && (lr1110_ctx.callbacks.process_cb != SIGFOX_NULL)) {
+        lr1110_ctx.callbacks.process_cb();
+    }
+}
 #endif
-#ifdef SIGFOX_EP_ERROR_CODES
-errors:
+
+#ifdef LR11XX_RF_API_ASYNC_HAL
+/*******************************************************************/
+static void _lr11xx_hal_cplt_callback(void) {
+    lr1110_ctx.hal_cplt_flag = 1;
+    if (lr1110_ctx.callbacks.process_cb != SIGFOX_NULL) {
+        lr1110_ctx.callbacks.process_cb();
+    }
+}
 #endif
-    SIGFOX_RETURN();
+
+#ifdef LR11XX_RF_API_STATISTICS
+/*******************************************************************/
+static void _lr11xx_stats_count_irq(lr11xx_system_irq_mask_t irq_mask) {
+    if (irq_mask & LR11XX_SYSTEM_IRQ_TX_DONE) {
+        lr1110_ctx.stats.irq_tx_done_count++;
+    }
+    if (irq_mask & LR11XX_SYSTEM_IRQ_RX_DONE) {
+        lr1110_ctx.stats.irq_rx_done_count++;
+    }
+    if (irq_mask & LR11XX_SYSTEM_IRQ_TIMEOUT) {
+        lr1110_ctx.stats.irq_timeout_count++;
+    }
+    if (irq_mask & LR11XX_SYSTEM_IRQ_ERROR) {
+        lr1110_ctx.stats.irq_error_count++;
+    }
+    if ((irq_mask & (LR11XX_SYSTEM_IRQ_TX_DONE | LR11XX_SYSTEM_IRQ_RX_DONE | LR11XX_SYSTEM_IRQ_TIMEOUT | LR11XX_SYSTEM_IRQ_ERROR)) == 0) {
+        lr1110_ctx.stats.irq_other_count++;
+    }
 }
 #endif
 
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ERROR_CODES)
 /*******************************************************************/
-#ifdef SIGFOX_EP_ASYNCHRONOUS
-RF_API_status_t LR11XX_RF_API_process(void) {
-#else
-static RF_API_status_t LR11XX_RF_API_process(void) {
+static void _lr11xx_stats_count_error(RF_API_status_t status) {
+    if ((status != RF_API_SUCCESS) && (status < (RF_API_status_t) SIGFOX_RF_API_ERROR_LAST)) {
+        lr1110_ctx.stats.error_count[status]++;
+    }
+}
+#endif
+
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+/*******************************************************************/
+static void _lr11xx_flight_record(LR11XX_RF_API_flight_event_t event, sfx_u8 arg8, sfx_u32 arg32) {
+    LR11XX_RF_API_flight_record_t *record = &(lr11xx_flight_recorder.records[lr11xx_flight_recorder.index]);
+    sfx_u32 timestamp_us = lr11xx_flight_recorder.timestamp_us;
+    sfx_u32 delta_us = 0;
+    // Timestamp failures are not reported: the event is recorded with a null delta.
+    LR11XX_HW_API_get_timestamp_us(&timestamp_us);
+    delta_us = (timestamp_us - lr11xx_flight_recorder.timestamp_us);
+    lr11xx_flight_recorder.timestamp_us = timestamp_us;
+    if (delta_us > LR11XX_RF_API_FLIGHT_RECORDER_DELTA_MAX) {
+        delta_us >>= 10;
+        if (delta_us > LR11XX_RF_API_FLIGHT_RECORDER_DELTA_MAX) {
+            delta_us = LR11XX_RF_API_FLIGHT_RECORDER_DELTA_MAX;
+        }
+        delta_us |= LR11XX_RF_API_FLIGHT_RECORDER_DELTA_COARSE;
+    }
+    record->event = (sfx_u8) event;
+    record->arg8 = arg8;
+    record->delta_time = (sfx_u16) delta_us;
+    record->arg32 = arg32;
+    lr11xx_flight_recorder.index = (sfx_u16) ((lr11xx_flight_recorder.index + 1) & (LR11XX_RF_API_FLIGHT_RECORDER - 1));
+}
 #endif
+
+#ifdef LR11XX_RF_API_SHARED_BUS
+/*******************************************************************/
+static RF_API_status_t _lr11xx_bus_acquire(void) {
 #ifdef SIGFOX_EP_ERROR_CODES
     RF_API_status_t status = RF_API_SUCCESS;
     LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
 #endif
-    lr11xx_system_irq_mask_t lr11xx_system_irq_mask;
-    lr11xx_status_t lr11xx_status;
-    if (lr1110_ctx.irq_flag != 1) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_STATE);
-    }
-    lr1110_ctx.irq_flag = 0;
-
-    lr11xx_status = lr11xx_system_get_and_clear_irq_status(SIGFOX_NULL, &lr11xx_system_irq_mask);
-    if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
-    }
-    if (lr11xx_system_irq_mask & LR11XX_SYSTEM_IRQ_TX_DONE) {
+    if (lr1110_ctx.bus_acquired == SIGFOX_FALSE) {
 #ifdef SIGFOX_EP_ERROR_CODES
-        lr11xx_hw_api_status = LR11XX_HW_API_tx_off();
+        lr11xx_hw_api_status = LR11XX_HW_API_bus_acquire();
         LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
 #else
-        LR11XX_HW_API_tx_off();
-#endif
-        lr1110_ctx.tx_done_flag = 1;
-#ifdef SIGFOX_EP_ASYNCHRONOUS
-        if (lr1110_ctx.callbacks.tx_cplt_cb != SIGFOX_NULL) {
-            lr1110_ctx.callbacks.tx_cplt_cb();
-        }
+        LR11XX_HW_API_bus_acquire();
 #endif
-    }
-#ifdef SIGFOX_EP_BIDIRECTIONAL
-    if (lr11xx_system_irq_mask & LR11XX_SYSTEM_IRQ_RX_DONE) {
+        lr1110_ctx.bus_acquired = SIGFOX_TRUE;
 #ifdef SIGFOX_EP_ERROR_CODES
-        lr11xx_hw_api_status = LR11XX_HW_API_rx_off();
+        lr11xx_hw_api_status = LR11XX_HW_API_get_timestamp_us(&lr1110_ctx.bus_acquire_timestamp_us);
         LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
 #else
-        LR11XX_HW_API_rx_off();
-#endif
-        lr1110_ctx.rx_done_flag = 1;
-#ifdef SIGFOX_EP_ASYNCHRONOUS
-        if (lr1110_ctx.callbacks.rx_data_received_cb != SIGFOX_NULL) {
-            lr1110_ctx.callbacks.rx_data_received_cb();
-        }
+        LR11XX_HW_API_get_timestamp_us(&lr1110_ctx.bus_acquire_timestamp_us);
 #endif
     }
-#endif
-    if (lr11xx_system_irq_mask & LR11XX_SYSTEM_IRQ_ERROR) {
-        lr1110_ctx.error_flag = 1;
-#ifdef SIGFOX_EP_ASYNCHRONOUS
-        if (lr1110_ctx.callbacks.error_cb != SIGFOX_NULL) {
 #ifdef SIGFOX_EP_ERROR_CODES
-            lr1110_ctx.callbacks.error_cb((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_IRQ);
-#else
-            lr1110_ctx.callbacks.error_cb();
-#endif
-        }
-#endif
-    }
-    SIGFOX_RETURN();
 errors:
-#ifdef SIGFOX_EP_ASYNCHRONOUS
-#ifdef SIGFOX_EP_ERROR_CODES
-    lr1110_ctx.callbacks.error_cb(RF_API_ERROR);
-#else
-    lr1110_ctx.callbacks.error_cb();
-#endif
 #endif
     SIGFOX_RETURN();
 }
+#endif
 
-#ifdef SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE
+#ifdef LR11XX_RF_API_SHARED_BUS
 /*******************************************************************/
-RF_API_status_t LR11XX_RF_API_close(void) {
+static void _lr11xx_bus_release(void) {
 #ifdef SIGFOX_EP_ERROR_CODES
-    RF_API_status_t status = RF_API_SUCCESS;
     LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
 #endif
+    sfx_u32 timestamp_us = 0;
+    sfx_u32 hold_time_us = 0;
+    // This function is also called on error exit paths: failures are only logged in the error stack.
+    if (lr1110_ctx.bus_acquired == SIGFOX_TRUE) {
+        lr1110_ctx.bus_acquired = SIGFOX_FALSE;
 #ifdef SIGFOX_EP_ERROR_CODES
-    lr11xx_hw_api_status = LR11XX_HW_API_close();
-    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+        lr11xx_hw_api_status = LR11XX_HW_API_bus_release();
+        if (lr11xx_hw_api_status != LR11XX_HW_API_SUCCESS) {
+            LR11XX_HW_API_stack_error();
+        }
+        lr11xx_hw_api_status = LR11XX_HW_API_get_timestamp_us(&timestamp_us);
+        if (lr11xx_hw_api_status != LR11XX_HW_API_SUCCESS) {
+            LR11XX_HW_API_stack_error();
+            timestamp_us = lr1110_ctx.bus_acquire_timestamp_us;
+        }
 #else
-    LR11XX_HW_API_close();
+        LR11XX_HW_API_bus_release();
+        LR11XX_HW_API_get_timestamp_us(&timestamp_us);
 #endif
-#ifdef SIGFOX_EP_ERROR_CODES
-errors:
-#endif
-    SIGFOX_RETURN();
+        hold_time_us = (timestamp_us - lr1110_ctx.bus_acquire_timestamp_us);
+        lr1110_ctx.bus_stats.acquire_count++;
+        lr1110_ctx.bus_stats.hold_time_last_us = hold_time_us;
+        lr1110_ctx.bus_stats.hold_time_total_us += hold_time_us;
+        if (hold_time_us > lr1110_ctx.bus_stats.hold_time_max_us) {
+            lr1110_ctx.bus_stats.hold_time_max_us = hold_time_us;
+        }
+    }
 }
 #endif
 
 /*******************************************************************/
-RF_API_status_t LR11XX_RF_API_wake_up(void) {
+static RF_API_status_t _lr11xx_set_irq_config(void) {
 #ifdef SIGFOX_EP_ERROR_CODES
     RF_API_status_t status = RF_API_SUCCESS;
-    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
 #endif
     lr11xx_status_t lr11xx_status;
-    lr11xx_system_errors_t errors;
-    lr11xx_system_rfswitch_cfg_t rf_switch_setup = {0};
-    lr11xx_system_version_t lr11xx_system_version;
-    LR11XX_HW_API_xosc_cfg_t xosc_cfg;
-    lr11xx_status = lr11xx_system_reset(SIGFOX_NULL);
-    sfx_u8 rfsw_dio_mask;
+    // Timeout is raised by the TX watchdog given to lr11xx_radio_set_tx() (the reception has no timeout).
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    lr11xx_status = lr11xx_system_set_dio_irq_params(SIGFOX_NULL, LR11XX_SYSTEM_IRQ_TX_DONE | LR11XX_SYSTEM_IRQ_RX_DONE | LR11XX_SYSTEM_IRQ_TIMEOUT | LR11XX_SYSTEM_IRQ_ERROR, 0);
+#else
+    lr11xx_status = lr11xx_system_set_dio_irq_params(SIGFOX_NULL, LR11XX_SYSTEM_IRQ_TX_DONE | LR11XX_SYSTEM_IRQ_TIMEOUT | LR11XX_SYSTEM_IRQ_ERROR, 0);
+#endif
     if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RESET);
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
     }
-    lr11xx_status = lr11xx_system_wakeup(SIGFOX_NULL);
+    lr11xx_status = lr11xx_system_clear_irq_status(SIGFOX_NULL, LR11XX_SYSTEM_IRQ_ALL_MASK);
     if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_WAKEUP);
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
     }
+errors:
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+#ifdef LR11XX_HW_API_STATIC_CONFIG
+static RF_API_status_t _lr11xx_get_rf_switch_cfg(lr11xx_system_rfswitch_cfg_t *rf_switch_cfg) {
 #ifdef SIGFOX_EP_ERROR_CODES
-    lr11xx_hw_api_status = LR11XX_HW_API_delayMs(100);
-    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+    (*rf_switch_cfg) = LR11XX_RF_API_RF_SWITCH_CFG;
+    SIGFOX_RETURN();
+}
 #else
-    LR11XX_HW_API_delayMs(100);
+static RF_API_status_t _lr11xx_get_rf_switch_cfg(lr11xx_system_rfswitch_cfg_t *rf_switch_cfg) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
 #endif
-    lr11xx_status = lr11xx_system_set_reg_mode(SIGFOX_NULL, LR11XX_SYSTEM_REG_MODE_LDO);
-    if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
-    }
+    sfx_u8 rfsw_dio_mask;
 #ifdef SIGFOX_EP_ERROR_CODES
     lr11xx_hw_api_status = LR11XX_HW_API_get_fem_mask(LR11XX_HW_API_FEM_PIN_USED, &rfsw_dio_mask);
     LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
-    rf_switch_setup.enable = rfsw_dio_mask;
+    rf_switch_cfg->enable = rfsw_dio_mask;
     lr11xx_hw_api_status = LR11XX_HW_API_get_fem_mask(LR11XX_HW_API_FEM_STBY, &rfsw_dio_mask);
     LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
-    rf_switch_setup.standby = rfsw_dio_mask;
+    rf_switch_cfg->standby = rfsw_dio_mask;
     lr11xx_hw_api_status = LR11XX_HW_API_get_fem_mask(LR11XX_HW_API_FEM_TX, &rfsw_dio_mask);
     LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
-    rf_switch_setup.tx = rfsw_dio_mask;
+    rf_switch_cfg->tx = rfsw_dio_mask;
     lr11xx_hw_api_status = LR11XX_HW_API_get_fem_mask(LR11XX_HW_API_FEM_TXHP, &rfsw_dio_mask);
     LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
-    rf_switch_setup.tx_hp = rfsw_dio_mask;
+    rf_switch_cfg->tx_hp = rfsw_dio_mask;
     lr11xx_hw_api_status = LR11XX_HW_API_get_fem_mask(LR11XX_HW_API_FEM_RX, &rfsw_dio_mask);
     LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
-    rf_switch_setup.rx = rfsw_dio_mask;
+    rf_switch_cfg->rx = rfsw_dio_mask;
     lr11xx_hw_api_status = LR11XX_HW_API_get_fem_mask(LR11XX_HW_API_FEM_WIFI, &rfsw_dio_mask);
     LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
-    rf_switch_setup.wifi = rfsw_dio_mask;
+    rf_switch_cfg->wifi = rfsw_dio_mask;
     lr11xx_hw_api_status = LR11XX_HW_API_get_fem_mask(LR11XX_HW_API_FEM_GNSS, &rfsw_dio_mask);
     LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
-    rf_switch_setup.gnss = rfsw_dio_mask;
+    rf_switch_cfg->gnss = rfsw_dio_mask;
 #else
     LR11XX_HW_API_get_fem_mask(LR11XX_HW_API_FEM_PIN_USED, &rfsw_dio_mask);
-    rf_switch_setup.enable = rfsw_dio_mask;
+    rf_switch_cfg->enable = rfsw_dio_mask;
     LR11XX_HW_API_get_fem_mask(LR11XX_HW_API_FEM_STBY, &rfsw_dio_mask);
-    rf_switch_setup.standby = rfsw_dio_mask;
+    rf_switch_cfg->standby = rfsw_dio_mask;
     LR11XX_HW_API_get_fem_mask(LR11XX_HW_API_FEM_TX, &rfsw_dio_mask);
-    rf_switch_setup.tx = rfsw_dio_mask;
+    rf_switch_cfg->tx = rfsw_dio_mask;
     LR11XX_HW_API_get_fem_mask(LR11XX_HW_API_FEM_TXHP, &rfsw_dio_mask);
-    rf_switch_setup.tx_hp = rfsw_dio_mask;
+    rf_switch_cfg->tx_hp = rfsw_dio_mask;
     LR11XX_HW_API_get_fem_mask(LR11XX_HW_API_FEM_RX, &rfsw_dio_mask);
-    rf_switch_setup.rx = rfsw_dio_mask;
+    rf_switch_cfg->rx = rfsw_dio_mask;
     LR11XX_HW_API_get_fem_mask(LR11XX_HW_API_FEM_WIFI, &rfsw_dio_mask);
-    rf_switch_setup.wifi = rfsw_dio_mask;
+    rf_switch_cfg->wifi = rfsw_dio_mask;
     LR11XX_HW_API_get_fem_mask(LR11XX_HW_API_FEM_GNSS, &rfsw_dio_mask);
-    rf_switch_setup.gnss = rfsw_dio_mask;
+    rf_switch_cfg->gnss = rfsw_dio_mask;
 #endif
-    lr11xx_status = lr11xx_system_set_dio_as_rf_switch(SIGFOX_NULL, &rf_switch_setup);
-    if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
-    }
-    lr11xx_status = lr11xx_system_cfg_lfclk(SIGFOX_NULL, LR11XX_SYSTEM_LFCLK_RC, true);
-    if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
-    }
-    lr11xx_status = lr11xx_system_clear_errors(SIGFOX_NULL);
-    if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
-    }
 #ifdef SIGFOX_EP_ERROR_CODES
-    lr11xx_hw_api_status = LR11XX_HW_API_get_xosc_cfg(&xosc_cfg);
-    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
-#else
-    LR11XX_HW_API_get_xosc_cfg(&xosc_cfg);
+errors:
 #endif
-    if (xosc_cfg.has_tcxo == 0x01) {
-        switch (xosc_cfg.tcxo_supply_voltage) {
+    SIGFOX_RETURN();
+}
+#endif
+
+/*******************************************************************/
+static RF_API_status_t _lr11xx_set_tcxo_mode(LR11XX_HW_API_xosc_cfg_t *xosc_cfg) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+    if (xosc_cfg->has_tcxo == 0x01) {
+        switch (xosc_cfg->tcxo_supply_voltage) {
         case LR11XX_HW_API_TCXO_CTRL_1_6V:
-            lr11xx_status = lr11xx_system_set_tcxo_mode(SIGFOX_NULL, LR11XX_SYSTEM_TCXO_CTRL_1_6V, xosc_cfg.startup_time_in_tick);
+            lr11xx_status = lr11xx_system_set_tcxo_mode(SIGFOX_NULL, LR11XX_SYSTEM_TCXO_CTRL_1_6V, xosc_cfg->startup_time_in_tick);
             break;
         case LR11XX_HW_API_TCXO_CTRL_1_7V:
-            lr11xx_status = lr11xx_system_set_tcxo_mode(SIGFOX_NULL, LR11XX_SYSTEM_TCXO_CTRL_1_7V, xosc_cfg.startup_time_in_tick);
+            lr11xx_status = lr11xx_system_set_tcxo_mode(SIGFOX_NULL, LR11XX_SYSTEM_TCXO_CTRL_1_7V, xosc_cfg->startup_time_in_tick);
             break;
         case LR11XX_HW_API_TCXO_CTRL_1_8V:
-            lr11xx_status = lr11xx_system_set_tcxo_mode(SIGFOX_NULL, LR11XX_SYSTEM_TCXO_CTRL_1_8V, xosc_cfg.startup_time_in_tick);
+            lr11xx_status = lr11xx_system_set_tcxo_mode(SIGFOX_NULL, LR11XX_SYSTEM_TCXO_CTRL_1_8V, xosc_cfg->startup_time_in_tick);
             break;
         case LR11XX_HW_API_TCXO_CTRL_2_2V:
-            lr11xx_status = lr11xx_system_set_tcxo_mode(SIGFOX_NULL, LR11XX_SYSTEM_TCXO_CTRL_2_2V, xosc_cfg.startup_time_in_tick);
+            lr11xx_status = lr11xx_system_set_tcxo_mode(SIGFOX_NULL, LR11XX_SYSTEM_TCXO_CTRL_2_2V, xosc_cfg->startup_time_in_tick);
             break;
         case LR11XX_HW_API_TCXO_CTRL_2_4V:
-            lr11xx_status = lr11xx_system_set_tcxo_mode(SIGFOX_NULL, LR11XX_SYSTEM_TCXO_CTRL_2_4V, xosc_cfg.startup_time_in_tick);
+            lr11xx_status = lr11xx_system_set_tcxo_mode(SIGFOX_NULL, LR11XX_SYSTEM_TCXO_CTRL_2_4V, xosc_cfg->startup_time_in_tick);
             break;
         case LR11XX_HW_API_TCXO_CTRL_2_7V:
-            lr11xx_status = lr11xx_system_set_tcxo_mode(SIGFOX_NULL, LR11XX_SYSTEM_TCXO_CTRL_2_7V, xosc_cfg.startup_time_in_tick);
+            lr11xx_status = lr11xx_system_set_tcxo_mode(SIGFOX_NULL, LR11XX_SYSTEM_TCXO_CTRL_2_7V, xosc_cfg->startup_time_in_tick);
             break;
         case LR11XX_HW_API_TCXO_CTRL_3_0V:
-            lr11xx_status = lr11xx_system_set_tcxo_mode(SIGFOX_NULL, LR11XX_SYSTEM_TCXO_CTRL_3_0V, xosc_cfg.startup_time_in_tick);
+            lr11xx_status = lr11xx_system_set_tcxo_mode(SIGFOX_NULL, LR11XX_SYSTEM_TCXO_CTRL_3_0V, xosc_cfg->startup_time_in_tick);
             break;
         case LR11XX_HW_API_TCXO_CTRL_3_3V:
-            lr11xx_status = lr11xx_system_set_tcxo_mode(SIGFOX_NULL, LR11XX_SYSTEM_TCXO_CTRL_3_3V, xosc_cfg.startup_time_in_tick);
+            lr11xx_status = lr11xx_system_set_tcxo_mode(SIGFOX_NULL, LR11XX_SYSTEM_TCXO_CTRL_3_3V, xosc_cfg->startup_time_in_tick);
             break;
         default:
             lr11xx_status = LR11XX_STATUS_ERROR;
@@ -361,497 +748,3576 @@ RF_API_status_t LR11XX_RF_API_wake_up(void) {
             SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
         }
     }
+errors:
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+static RF_API_status_t _lr11xx_detect_chip_variant(void) {
 #ifdef SIGFOX_EP_ERROR_CODES
-    lr11xx_hw_api_status = LR11XX_HW_API_delayMs(50);
-    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
-#else
-    LR11XX_HW_API_delayMs(50);
+    RF_API_status_t status = RF_API_SUCCESS;
 #endif
-    // Set standby on XOSC oscillator to keep the XOSC powered in standby mode and limit warmup time at every Sigfox frame.
-    lr11xx_status = lr11xx_system_set_standby(SIGFOX_NULL, LR11XX_SYSTEM_STANDBY_CFG_XOSC);
+    lr11xx_status_t lr11xx_status;
+    lr11xx_system_version_t lr11xx_system_version;
+    // The version is only read once: the chip can not change while the driver is running.
+    if (lr1110_ctx.chip_variant != LR11XX_RF_API_CHIP_VARIANT_UNKNOWN) {
+        goto errors;
+    }
+    lr11xx_status = lr11xx_system_get_version(SIGFOX_NULL, &lr11xx_system_version);
     if (lr11xx_status != LR11XX_STATUS_OK) {
         SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
     }
+    switch (lr11xx_system_version.type) {
+    case LR11XX_SYSTEM_VERSION_TYPE_LR1110:
+        lr1110_ctx.chip_variant = LR11XX_RF_API_CHIP_VARIANT_LR1110;
+        break;
+    case LR11XX_SYSTEM_VERSION_TYPE_LR1120:
+        lr1110_ctx.chip_variant = LR11XX_RF_API_CHIP_VARIANT_LR1120;
+        break;
+    case LR11XX_SYSTEM_VERSION_TYPE_LR1121:
+        lr1110_ctx.chip_variant = LR11XX_RF_API_CHIP_VARIANT_LR1121;
+        break;
+    default:
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_VARIANT);
+    }
+errors:
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+static void _lr11xx_mask_rf_switch_cfg(lr11xx_system_rfswitch_cfg_t *rf_switch_cfg) {
+    const chip_variant_profile_t *profile = &(LR11XX_RF_API_CHIP_VARIANT_PROFILE[lr1110_ctx.chip_variant]);
+    // Drop the entries of the paths which do not exist on the detected chip.
+    if (profile->gnss_wifi == SIGFOX_FALSE) {
+        rf_switch_cfg->gnss = 0;
+        rf_switch_cfg->wifi = 0;
+    }
+    if (profile->hf_pa == SIGFOX_FALSE) {
+        rf_switch_cfg->tx_hf = 0;
+    }
+}
+
+#ifdef LR11XX_RF_API_RC_PROFILES
+/*******************************************************************/
+static sfx_bool _lr11xx_rf_switch_cfg_equal(const lr11xx_system_rfswitch_cfg_t *cfg_1, const lr11xx_system_rfswitch_cfg_t *cfg_2) {
+    return ((cfg_1->enable == cfg_2->enable) && (cfg_1->standby == cfg_2->standby) && (cfg_1->rx == cfg_2->rx) && (cfg_1->tx == cfg_2->tx) && (cfg_1->tx_hp == cfg_2->tx_hp) && (cfg_1->tx_hf == cfg_2->tx_hf) && (cfg_1->gnss == cfg_2->gnss) && (cfg_1->wifi == cfg_2->wifi)) ? SIGFOX_TRUE : SIGFOX_FALSE;
+}
+#endif
+
+#ifdef LR11XX_RF_API_RC_PROFILES
+/*******************************************************************/
+static sfx_bool _lr11xx_xosc_cfg_equal(const LR11XX_HW_API_xosc_cfg_t *cfg_1, const LR11XX_HW_API_xosc_cfg_t *cfg_2) {
+    return ((cfg_1->has_tcxo == cfg_2->has_tcxo) && (cfg_1->tcxo_supply_voltage == cfg_2->tcxo_supply_voltage) && (cfg_1->startup_time_in_tick == cfg_2->startup_time_in_tick)) ? SIGFOX_TRUE : SIGFOX_FALSE;
+}
+#endif
+
+#ifdef LR11XX_RF_API_RC_PROFILES
+/*******************************************************************/
+static RF_API_status_t _lr11xx_load_rc_profile(sfx_u8 profile_index, const SIGFOX_rc_t *rc) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+    rc_profile_t *profile = &(lr1110_ctx.rc_profiles[profile_index]);
+    const SIGFOX_rc_t *active_rc = lr1110_ctx.rc_profiles[lr1110_ctx.rc_profile_index].rc;
+    sfx_u32 rc_freq_min_hz = 0;
+    sfx_u32 rc_freq_max_hz = 0;
+    // RC is dereferenced below: checked even without SIGFOX_EP_PARAMETERS_CHECK.
+    if (rc == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_NULL_PARAMETER);
+    }
+    rc_freq_min_hz = (rc->f_ul_hz < rc->f_dl_hz) ? rc->f_ul_hz : rc->f_dl_hz;
+    rc_freq_max_hz = (rc->f_ul_hz > rc->f_dl_hz) ? rc->f_ul_hz : rc->f_dl_hz;
+    profile->rc = SIGFOX_NULL;
+    profile->pa_pwr_cfg_valid = SIGFOX_FALSE;
+    // Calibration range covering both macro channels.
+    profile->image_calib_freq1_mhz = (sfx_u16) ((rc_freq_min_hz - (rc->macro_channel_width_hz / 2)) / 1000000);
+    profile->image_calib_freq2_mhz = (sfx_u16) ((rc_freq_max_hz + (rc->macro_channel_width_hz / 2) + 999999) / 1000000);
+    // Select the RC on board side to read the matching front-end settings.
 #ifdef SIGFOX_EP_ERROR_CODES
-    lr11xx_hw_api_status = LR11XX_HW_API_delayMs(300);
+    lr11xx_hw_api_status = LR11XX_HW_API_set_rc(rc);
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+    status = _lr11xx_get_rf_switch_cfg(&(profile->rf_switch_cfg));
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#ifndef LR11XX_HW_API_STATIC_CONFIG
+    lr11xx_hw_api_status = LR11XX_HW_API_get_xosc_cfg(&(profile->xosc_cfg));
     LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#endif
 #else
-    LR11XX_HW_API_delayMs(300);
+    LR11XX_HW_API_set_rc(rc);
+    _lr11xx_get_rf_switch_cfg(&(profile->rf_switch_cfg));
+#ifndef LR11XX_HW_API_STATIC_CONFIG
+    LR11XX_HW_API_get_xosc_cfg(&(profile->xosc_cfg));
 #endif
-#ifdef SIGFOX_EP_BIDIRECTIONAL
-    lr11xx_status = lr11xx_system_set_dio_irq_params(SIGFOX_NULL, LR11XX_SYSTEM_IRQ_TX_DONE | LR11XX_SYSTEM_IRQ_RX_DONE | LR11XX_SYSTEM_IRQ_ERROR, 0);
+#endif
+#ifdef LR11XX_HW_API_STATIC_CONFIG
+    profile->xosc_cfg = LR11XX_RF_API_XOSC_CFG;
+#endif
+    profile->rc = rc;
+    // Restore the active RC on board side.
+    if ((active_rc != SIGFOX_NULL) && (active_rc != rc)) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        lr11xx_hw_api_status = LR11XX_HW_API_set_rc(active_rc);
+        LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
 #else
-    lr11xx_status = lr11xx_system_set_dio_irq_params(SIGFOX_NULL, LR11XX_SYSTEM_IRQ_TX_DONE | LR11XX_SYSTEM_IRQ_ERROR, 0);
+        LR11XX_HW_API_set_rc(active_rc);
 #endif
-    if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
-    }
-    lr11xx_status = lr11xx_system_clear_irq_status(SIGFOX_NULL, LR11XX_SYSTEM_IRQ_ALL_MASK);
-    if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
-    }
-    lr11xx_status = lr11xx_system_get_version(SIGFOX_NULL, &lr11xx_system_version);
-    if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
-    }
-    lr11xx_status = lr11xx_system_get_errors(SIGFOX_NULL, &errors);
-    if ((lr11xx_status != LR11XX_STATUS_OK) || (errors != 0)) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
     }
-    lr1110_ctx.irq_en = 1;
 errors:
     SIGFOX_RETURN();
 }
+#endif
 
+#ifdef LR11XX_RF_API_RC_PROFILES
 /*******************************************************************/
-RF_API_status_t LR11XX_RF_API_sleep(void) {
+static RF_API_status_t _lr11xx_calibrate_image(const rc_profile_t *profile) {
 #ifdef SIGFOX_EP_ERROR_CODES
     RF_API_status_t status = RF_API_SUCCESS;
 #endif
     lr11xx_status_t lr11xx_status;
-    lr11xx_system_sleep_cfg_t lr11xx_system_sleep_cfg;
-    lr1110_ctx.irq_en = 0;
-    lr11xx_system_sleep_cfg.is_warm_start = 0;
-    lr11xx_system_sleep_cfg.is_rtc_timeout = 0;
-    lr11xx_status = lr11xx_system_set_sleep(SIGFOX_NULL, lr11xx_system_sleep_cfg, 0);
-    if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    if ((profile->image_calib_freq1_mhz != lr1110_ctx.applied_image_calib_freq1_mhz) || (profile->image_calib_freq2_mhz != lr1110_ctx.applied_image_calib_freq2_mhz)) {
+        lr11xx_status = lr11xx_system_calibrate_image_in_mhz(SIGFOX_NULL, profile->image_calib_freq1_mhz, profile->image_calib_freq2_mhz);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+        }
+        lr1110_ctx.applied_image_calib_freq1_mhz = profile->image_calib_freq1_mhz;
+        lr1110_ctx.applied_image_calib_freq2_mhz = profile->image_calib_freq2_mhz;
     }
 errors:
     SIGFOX_RETURN();
 }
+#endif
 
+#ifdef LR11XX_RF_API_RC_PROFILES
 /*******************************************************************/
-RF_API_status_t LR11XX_RF_API_init(RF_API_radio_parameters_t *radio_parameters) {
+static RF_API_status_t _lr11xx_apply_rc_profile(void) {
 #ifdef SIGFOX_EP_ERROR_CODES
     RF_API_status_t status = RF_API_SUCCESS;
-    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
 #endif
     lr11xx_status_t lr11xx_status;
-    lr11xx_radio_mod_params_bpsk_t lr11xx_radio_mod_params_bpsk;
-    lr11xx_radio_pa_cfg_t lr11xx_radio_pa_cfg;
-    lr11xx_radio_mod_params_gfsk_t lr11xx_radio_mod_params_gfsk;
-    LR11XX_HW_API_pa_pwr_cfg_t lr11xx_hw_api_pa_pwr_cfg;
-    lr11xx_status = lr11xx_radio_set_rf_freq(SIGFOX_NULL, radio_parameters->frequency_hz);
-    if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
-    }
-    switch (radio_parameters->modulation) {
-    case RF_API_MODULATION_DBPSK:
-        lr11xx_status = lr11xx_radio_set_pkt_type(SIGFOX_NULL, LR11XX_RADIO_PKT_TYPE_BPSK);
-        if (lr11xx_status != LR11XX_STATUS_OK) {
-            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
-        }
-        lr11xx_radio_mod_params_bpsk.br_in_bps = radio_parameters->bit_rate_bps;
-        lr11xx_radio_mod_params_bpsk.pulse_shape = LR11XX_RADIO_DBPSK_PULSE_SHAPE;
-        lr11xx_status = lr11xx_radio_set_bpsk_mod_params(SIGFOX_NULL, &lr11xx_radio_mod_params_bpsk);
-        if (lr11xx_status != LR11XX_STATUS_OK) {
-            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
-        }
-        break;
-    case RF_API_MODULATION_GFSK:
-        lr11xx_status = lr11xx_radio_set_pkt_type(SIGFOX_NULL, LR11XX_RADIO_PKT_TYPE_GFSK);
-        if (lr11xx_status != LR11XX_STATUS_OK) {
-            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
-        }
-        lr11xx_radio_mod_params_gfsk.br_in_bps = radio_parameters->bit_rate_bps;
-#ifdef SIGFOX_EP_BIDIRECTIONAL
-        lr11xx_radio_mod_params_gfsk.fdev_in_hz = radio_parameters->deviation_hz;
+    rc_profile_t *profile = &(lr1110_ctx.rc_profiles[lr1110_ctx.rc_profile_index]);
+    lr11xx_system_rfswitch_cfg_t rf_switch_cfg = profile->rf_switch_cfg;
+#ifdef LR11XX_RF_API_BULK_MODE
+    lr1110_ctx.bulk_radio_valid = SIGFOX_FALSE;
 #endif
-        lr11xx_radio_mod_params_gfsk.pulse_shape = LR11XX_RADIO_GFSK_PULSE_SHAPE_BT_1;
-        lr11xx_radio_mod_params_gfsk.bw_dsb_param = LR11XX_RADIO_GFSK_BW_4800;
-        lr11xx_status = lr11xx_radio_set_gfsk_mod_params(SIGFOX_NULL, &lr11xx_radio_mod_params_gfsk);
+    _lr11xx_mask_rf_switch_cfg(&rf_switch_cfg);
+    // Only send the commands for the settings which differ from the ones currently applied on the chip.
+    if (_lr11xx_rf_switch_cfg_equal(&rf_switch_cfg, &(lr1110_ctx.applied_rf_switch_cfg)) == SIGFOX_FALSE) {
+        lr11xx_status = lr11xx_system_set_dio_as_rf_switch(SIGFOX_NULL, &rf_switch_cfg);
         if (lr11xx_status != LR11XX_STATUS_OK) {
-            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
         }
-        break;
-    case RF_API_MODULATION_NONE:
-        lr11xx_status = lr11xx_radio_set_pkt_type(SIGFOX_NULL, LR11XX_RADIO_PKT_TYPE_RTTOF);
+        lr1110_ctx.applied_rf_switch_cfg = rf_switch_cfg;
+    }
+    if (_lr11xx_xosc_cfg_equal(&(profile->xosc_cfg), &(lr1110_ctx.applied_xosc_cfg)) == SIGFOX_FALSE) {
+        // TCXO mode can only be changed in standby RC.
+        lr11xx_status = lr11xx_system_set_standby(SIGFOX_NULL, LR11XX_SYSTEM_STANDBY_CFG_RC);
         if (lr11xx_status != LR11XX_STATUS_OK) {
-            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
         }
-        break;
-    default:
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_MODULATION);
-    }
-
-    if (radio_parameters->rf_mode == RF_API_MODE_TX) {
-        lr1110_ctx.backup_bit_rate_bps_patch = radio_parameters->bit_rate_bps;
 #ifdef SIGFOX_EP_ERROR_CODES
-        lr11xx_hw_api_status = LR11XX_HW_API_get_pa_pwr_cfg(&lr11xx_hw_api_pa_pwr_cfg, radio_parameters->frequency_hz, radio_parameters->tx_power_dbm_eirp);
-        LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+        status = _lr11xx_set_tcxo_mode(&(profile->xosc_cfg));
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
 #else
-        LR11XX_HW_API_get_pa_pwr_cfg(&lr11xx_hw_api_pa_pwr_cfg, radio_parameters->frequency_hz, radio_parameters->tx_power_dbm_eirp);
+        _lr11xx_set_tcxo_mode(&(profile->xosc_cfg));
 #endif
-        switch (lr11xx_hw_api_pa_pwr_cfg.pa_config.pa_sel) {
-        case LR11XX_HW_API_RADIO_PA_SEL_LP:
-            lr11xx_radio_pa_cfg.pa_sel = LR11XX_RADIO_PA_SEL_LP;
-            break;
-        case LR11XX_HW_API_RADIO_PA_SEL_HP:
-            lr11xx_radio_pa_cfg.pa_sel = LR11XX_RADIO_PA_SEL_HP;
-            break;
-        case LR11XX_HW_API_RADIO_PA_SEL_HF:
-            lr11xx_radio_pa_cfg.pa_sel = LR11XX_RADIO_PA_SEL_HF;
-            break;
-        default:
-            lr11xx_status = LR11XX_STATUS_ERROR;
-            break;
-        }
-        if (lr11xx_status != LR11XX_STATUS_OK) {
-            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
-        }
-        switch (lr11xx_hw_api_pa_pwr_cfg.pa_config.pa_reg_supply) {
-        case LR11XX_HW_API_RADIO_PA_REG_SUPPLY_VREG:
-            lr11xx_radio_pa_cfg.pa_reg_supply = LR11XX_RADIO_PA_REG_SUPPLY_VREG;
-            break;
-        case LR11XX_HW_API_RADIO_PA_REG_SUPPLY_VBAT:
-            lr11xx_radio_pa_cfg.pa_reg_supply = LR11XX_RADIO_PA_REG_SUPPLY_VBAT;
-            break;
-        default:
-            lr11xx_status = LR11XX_STATUS_ERROR;
-            break;
-        }
-        if (lr11xx_status != LR11XX_STATUS_OK) {
-            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
-        }
-        lr11xx_radio_pa_cfg.pa_hp_sel = lr11xx_hw_api_pa_pwr_cfg.pa_config.pa_hp_sel;
-        lr11xx_radio_pa_cfg.pa_duty_cycle = lr11xx_hw_api_pa_pwr_cfg.pa_config.pa_duty_cycle;
-        lr11xx_status = lr11xx_radio_set_pa_cfg(SIGFOX_NULL, &lr11xx_radio_pa_cfg);
-        if (lr11xx_status != LR11XX_STATUS_OK) {
-            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
-        }
-        lr11xx_status = lr11xx_radio_set_tx_params(SIGFOX_NULL, lr11xx_hw_api_pa_pwr_cfg.power, LR11XX_RADIO_RAMP_208_US);
-        if (lr11xx_status != LR11XX_STATUS_OK) {
-            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
-        }
-    }
-#ifdef SIGFOX_EP_BIDIRECTIONAL
-    if (radio_parameters->rf_mode == RF_API_MODE_RX) {
-        lr11xx_status = lr11xx_radio_cfg_rx_boosted(SIGFOX_NULL, 0x01);
+        lr11xx_status = lr11xx_system_set_standby(SIGFOX_NULL, LR11XX_SYSTEM_STANDBY_CFG_XOSC);
         if (lr11xx_status != LR11XX_STATUS_OK) {
-            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
         }
+        lr1110_ctx.applied_xosc_cfg = profile->xosc_cfg;
+        // Calibration has been performed again on the default range.
+        lr1110_ctx.applied_image_calib_freq1_mhz = 0;
+        lr1110_ctx.applied_image_calib_freq2_mhz = 0;
     }
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_calibrate_image(profile);
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_calibrate_image(profile);
 #endif
 errors:
     SIGFOX_RETURN();
 }
+#endif
 
+#ifdef LR11XX_HW_API_STATIC_CONFIG
 /*******************************************************************/
-RF_API_status_t LR11XX_RF_API_de_init(void) {
+static const LR11XX_HW_API_pa_pwr_band_t *_lr11xx_get_pa_pwr_band(sfx_u32 rf_freq_in_hz) {
+    sfx_u8 idx;
+    // Each band of the board descriptor has its own PA table entries.
+    for (idx = 0; idx < LR11XX_RF_API_PA_PWR_BANDS_SIZE; idx++) {
+        if ((rf_freq_in_hz >= LR11XX_RF_API_PA_PWR_BANDS[idx].min_freq_hz) && (rf_freq_in_hz <= LR11XX_RF_API_PA_PWR_BANDS[idx].max_freq_hz)) {
+            return &(LR11XX_RF_API_PA_PWR_BANDS[idx]);
+        }
+    }
+    return SIGFOX_NULL;
+}
+
+/*******************************************************************/
+static RF_API_status_t _lr11xx_get_pa_pwr_cfg(LR11XX_HW_API_pa_pwr_cfg_t *pa_pwr_cfg, sfx_u32 rf_freq_in_hz, sfx_s8 expected_output_pwr_in_dbm) {
 #ifdef SIGFOX_EP_ERROR_CODES
     RF_API_status_t status = RF_API_SUCCESS;
-    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
 #endif
-    lr11xx_status_t lr11xx_status;
-    lr11xx_status = lr11xx_system_set_standby(SIGFOX_NULL, LR11XX_SYSTEM_STANDBY_CFG_XOSC);
-    if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    const LR11XX_HW_API_pa_pwr_band_t *band = _lr11xx_get_pa_pwr_band(rf_freq_in_hz);
+    const LR11XX_HW_API_pa_pwr_table_entry_t *entry = SIGFOX_NULL;
+    sfx_u8 idx;
+    if (band == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_TX_POWER);
     }
-#ifdef SIGFOX_EP_BIDIRECTIONAL
-#ifdef SIGFOX_EP_ERROR_CODES
-    lr11xx_hw_api_status = LR11XX_HW_API_rx_off();
-    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
-#else
-    LR11XX_HW_API_rx_off();
-#endif
-#endif
-#ifdef SIGFOX_EP_ERROR_CODES
-    lr11xx_hw_api_status = LR11XX_HW_API_tx_off();
-    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
-#else
-    LR11XX_HW_API_tx_off();
-#endif
+    // Exact output power, or the highest one below so that the expected power is never exceeded.
+    for (idx = band->first_entry; idx < (band->first_entry + band->entry_count); idx++) {
+        if ((LR11XX_RF_API_PA_PWR_TABLE[idx].expected_output_pwr_in_dbm <= expected_output_pwr_in_dbm) && ((entry == SIGFOX_NULL) || (LR11XX_RF_API_PA_PWR_TABLE[idx].expected_output_pwr_in_dbm > entry->expected_output_pwr_in_dbm))) {
+            entry = &(LR11XX_RF_API_PA_PWR_TABLE[idx]);
+        }
+    }
+    if (entry == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_TX_POWER);
+    }
+    (*pa_pwr_cfg) = entry->pa_pwr_cfg;
 errors:
     SIGFOX_RETURN();
 }
-
+#else
 /*******************************************************************/
-RF_API_status_t LR11XX_RF_API_send(RF_API_tx_data_t *tx_data) {
+static RF_API_status_t _lr11xx_get_pa_pwr_cfg(LR11XX_HW_API_pa_pwr_cfg_t *pa_pwr_cfg, sfx_u32 rf_freq_in_hz, sfx_s8 expected_output_pwr_in_dbm) {
 #ifdef SIGFOX_EP_ERROR_CODES
     RF_API_status_t status = RF_API_SUCCESS;
     LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
 #endif
-    lr11xx_radio_pkt_params_bpsk_t lr11xx_radio_pkt_params_bpsk;
-    lr11xx_status_t lr11xx_status;
-    sfx_u8 buffer[SIGFOX_UL_BITSTREAM_SIZE_BYTES + 1];
-    sfx_u8 i;
-#ifdef SIGFOX_EP_ASYNCHRONOUS
-    lr1110_ctx.callbacks.tx_cplt_cb = tx_data->cplt_cb;
-#endif
-    lr1110_ctx.tx_done_flag = 0;
-    lr1110_ctx.error_flag = 0;
-    for (i = 0; i < tx_data->bitstream_size_bytes; i++) {
-        buffer[i] = tx_data->bitstream[i];
-    }
-    buffer[tx_data->bitstream_size_bytes] = 0x80;
-    dbpsk_encode_buffer(buffer, tx_data->bitstream_size_bytes * 8 + 2, buffer);
-    /*Set the BPSK packet param*/
-    lr11xx_radio_pkt_params_bpsk.pld_len_in_bits = (sfx_u16) dbpsk_get_pld_len_in_bits(tx_data->bitstream_size_bytes * 8);
-    lr11xx_radio_pkt_params_bpsk.pld_len_in_bytes = (sfx_u8) dbpsk_get_pld_len_in_bytes(tx_data->bitstream_size_bytes * 8);
-    if (lr1110_ctx.backup_bit_rate_bps_patch == 100) {
-        lr11xx_radio_pkt_params_bpsk.ramp_down_delay = LR11XX_RADIO_SIGFOX_DBPSK_RAMP_DOWN_TIME_100_BPS;
-        lr11xx_radio_pkt_params_bpsk.ramp_up_delay = LR11XX_RADIO_SIGFOX_DBPSK_RAMP_DOWN_TIME_100_BPS;
-    } else if (lr1110_ctx.backup_bit_rate_bps_patch == 600) {
-        lr11xx_radio_pkt_params_bpsk.ramp_down_delay = LR11XX_RADIO_SIGFOX_DBPSK_RAMP_DOWN_TIME_600_BPS;
-        lr11xx_radio_pkt_params_bpsk.ramp_up_delay = LR11XX_RADIO_SIGFOX_DBPSK_RAMP_DOWN_TIME_600_BPS;
-    }
-    lr11xx_status = lr11xx_radio_set_bpsk_pkt_params(SIGFOX_NULL, &lr11xx_radio_pkt_params_bpsk);
-    if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
-    }
-    lr11xx_status = lr11xx_regmem_write_buffer8(SIGFOX_NULL, buffer, lr11xx_radio_pkt_params_bpsk.pld_len_in_bytes);
-    if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_REGMEM_REG);
-    }
+#ifdef LR11XX_RF_API_RC_PROFILES
+    rc_profile_t *profile = &(lr1110_ctx.rc_profiles[lr1110_ctx.rc_profile_index]);
+    sfx_u32 pa_band = (rf_freq_in_hz / LR11XX_RF_API_PA_PWR_CFG_BAND_HZ);
+    if ((profile->pa_pwr_cfg_valid == SIGFOX_TRUE) && (profile->pa_band == pa_band) && (profile->pa_tx_power_dbm_eirp == expected_output_pwr_in_dbm)) {
+        (*pa_pwr_cfg) = profile->pa_pwr_cfg;
+    } else {
 #ifdef SIGFOX_EP_ERROR_CODES
-    lr11xx_hw_api_status = LR11XX_HW_API_tx_on();
-    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+        lr11xx_hw_api_status = LR11XX_HW_API_get_pa_pwr_cfg(pa_pwr_cfg, rf_freq_in_hz, expected_output_pwr_in_dbm);
+        LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
 #else
-    LR11XX_HW_API_tx_on();
+        LR11XX_HW_API_get_pa_pwr_cfg(pa_pwr_cfg, rf_freq_in_hz, expected_output_pwr_in_dbm);
 #endif
-    lr11xx_status = lr11xx_radio_set_tx(SIGFOX_NULL, 5000);
-    if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+        profile->pa_pwr_cfg = (*pa_pwr_cfg);
+        profile->pa_band = pa_band;
+        profile->pa_tx_power_dbm_eirp = expected_output_pwr_in_dbm;
+        profile->pa_pwr_cfg_valid = SIGFOX_TRUE;
     }
-#ifndef SIGFOX_EP_ASYNCHRONOUS
-    while (lr1110_ctx.tx_done_flag != 1) {
-        if (lr1110_ctx.irq_flag == 1) {
+#else
 #ifdef SIGFOX_EP_ERROR_CODES
-            status = LR11XX_RF_API_process();
-            SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+    lr11xx_hw_api_status = LR11XX_HW_API_get_pa_pwr_cfg(pa_pwr_cfg, rf_freq_in_hz, expected_output_pwr_in_dbm);
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
 #else
-            LR11XX_RF_API_process();
+    LR11XX_HW_API_get_pa_pwr_cfg(pa_pwr_cfg, rf_freq_in_hz, expected_output_pwr_in_dbm);
 #endif
-            if (lr1110_ctx.error_flag == 1) {
-                SIGFOX_EXIT_ERROR((RF_API_status_t) RF_API_ERROR);
-            }
-        }
-    }
 #endif
+#ifdef SIGFOX_EP_ERROR_CODES
 errors:
+#endif
     SIGFOX_RETURN();
 }
+#endif
 
-#ifdef SIGFOX_EP_BIDIRECTIONAL
+#ifdef LR11XX_RF_API_ERROR_RECOVERY
 /*******************************************************************/
-RF_API_status_t LR11XX_RF_API_receive(RF_API_rx_data_t *rx_data) {
-#ifdef SIGFOX_EP_ERROR_CODES
-    RF_API_status_t status = RF_API_SUCCESS;
-    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
-#ifndef SIGFOX_EP_ASYNCHRONOUS
-    MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
+static sfx_bool _lr11xx_recover(void) {
+    lr11xx_status_t lr11xx_status;
+    lr11xx_system_errors_t errors = 0;
+    lr11xx_system_cal_mask_t calib_mask = 0;
+    sfx_bool image_calib = SIGFOX_FALSE;
+    sfx_bool recovered = SIGFOX_FALSE;
+    LR11XX_RF_API_fault_t fault = LR11XX_RF_API_FAULT_COMMAND;
+#ifdef LR11XX_RF_API_RC_PROFILES
+    const rc_profile_t *profile = SIGFOX_NULL;
 #endif
+    // Escalate to a full reset after too many consecutive recoveries.
+    if (lr1110_ctx.recovery_info.consecutive_recovery_count < LR11XX_RF_API_ERROR_RECOVERY) {
+        lr11xx_status = lr11xx_system_get_errors(SIGFOX_NULL, &errors);
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+        _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_CHIP_ERRORS, (sfx_u8) lr11xx_status, (sfx_u32) errors);
 #endif
-    lr11xx_status_t lr11xx_status;
-    lr11xx_radio_pkt_params_gfsk_t lr11xx_radio_pkt_params_gfsk;
+        if (lr11xx_status == LR11XX_STATUS_OK) {
+            // Classify the fault (most severe last) and select the blocks to recalibrate.
+            if ((errors & LR11XX_SYSTEM_ERRORS_ADC_CALIB_MASK) != 0) {
+                fault = LR11XX_RF_API_FAULT_ADC;
+                calib_mask |= LR11XX_SYSTEM_CALIB_ADC_MASK;
+            }
+            if ((errors & LR11XX_SYSTEM_ERRORS_IMG_CALIB_MASK) != 0) {
+                fault = LR11XX_RF_API_FAULT_IMAGE;
+                image_calib = SIGFOX_TRUE;
+            }
+            if ((errors & (LR11XX_SYSTEM_ERRORS_HF_RC_CALIB_MASK | LR11XX_SYSTEM_ERRORS_LF_RC_CALIB_MASK)) != 0) {
+                fault = LR11XX_RF_API_FAULT_RC;
+                calib_mask |= LR11XX_SYSTEM_CALIB_HF_RC_MASK | LR11XX_SYSTEM_CALIB_LF_RC_MASK;
+            }
+            if ((errors & (LR11XX_SYSTEM_ERRORS_PLL_CALIB_MASK | LR11XX_SYSTEM_ERRORS_PLL_LOCK_MASK)) != 0) {
+                fault = LR11XX_RF_API_FAULT_PLL;
+                calib_mask |= LR11XX_SYSTEM_CALIB_PLL_MASK | LR11XX_SYSTEM_CALIB_PLL_TX_MASK;
+            }
+            if ((errors & (LR11XX_SYSTEM_ERRORS_HF_XOSC_START_MASK | LR11XX_SYSTEM_ERRORS_LF_XOSC_START_MASK)) != 0) {
+                fault = LR11XX_RF_API_FAULT_XOSC;
+            }
+        }
+        lr1110_ctx.recovery_info.last_fault = fault;
+        lr1110_ctx.recovery_info.last_chip_errors = (sfx_u16) errors;
+        // Oscillator faults and unreadable chip status can only be fixed by a reset.
+        if ((lr11xx_status == LR11XX_STATUS_OK) && (fault != LR11XX_RF_API_FAULT_XOSC)) {
+            lr11xx_status = lr11xx_system_set_standby(SIGFOX_NULL, LR11XX_SYSTEM_STANDBY_CFG_XOSC);
+            if ((lr11xx_status == LR11XX_STATUS_OK) && (calib_mask != 0)) {
+                lr11xx_status = lr11xx_system_calibrate(SIGFOX_NULL, calib_mask);
+            }
+            if ((lr11xx_status == LR11XX_STATUS_OK) && (image_calib == SIGFOX_TRUE)) {
+#ifdef LR11XX_RF_API_RC_PROFILES
+                // Same range as the wake-up and the profile switch: the applied range is unknown until the calibration succeeds.
+                profile = &(lr1110_ctx.rc_profiles[lr1110_ctx.rc_profile_index]);
+                lr1110_ctx.applied_image_calib_freq1_mhz = 0;
+                lr1110_ctx.applied_image_calib_freq2_mhz = 0;
+                lr11xx_status = lr11xx_system_calibrate_image_in_mhz(SIGFOX_NULL, profile->image_calib_freq1_mhz, profile->image_calib_freq2_mhz);
+                if (lr11xx_status == LR11XX_STATUS_OK) {
+                    lr1110_ctx.applied_image_calib_freq1_mhz = profile->image_calib_freq1_mhz;
+                    lr1110_ctx.applied_image_calib_freq2_mhz = profile->image_calib_freq2_mhz;
+                }
+#else
+                // Same default range as the wake-up calibration.
+                lr11xx_status = lr11xx_system_calibrate(SIGFOX_NULL, LR11XX_SYSTEM_CALIB_IMG_MASK);
+#endif
+            }
+            if (lr11xx_status == LR11XX_STATUS_OK) {
+                lr11xx_status = lr11xx_system_clear_errors(SIGFOX_NULL);
+            }
+            if (lr11xx_status == LR11XX_STATUS_OK) {
+                lr11xx_status = lr11xx_system_clear_irq_status(SIGFOX_NULL, LR11XX_SYSTEM_IRQ_ALL_MASK);
+            }
+            if (lr11xx_status == LR11XX_STATUS_OK) {
+                lr11xx_status = lr11xx_system_get_errors(SIGFOX_NULL, &errors);
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+                _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_CHIP_ERRORS, (sfx_u8) lr11xx_status, (sfx_u32) errors);
+#endif
+            }
+            recovered = ((lr11xx_status == LR11XX_STATUS_OK) && (errors == 0)) ? SIGFOX_TRUE : SIGFOX_FALSE;
+        }
+    }
+    if (recovered == SIGFOX_TRUE) {
+        lr1110_ctx.recovery_info.consecutive_recovery_count++;
+        lr1110_ctx.recovery_info.recovery_count++;
+    } else {
+        lr1110_ctx.recovery_info.consecutive_recovery_count = 0;
+        lr1110_ctx.recovery_info.reset_count++;
+    }
+    return recovered;
+}
+#endif
+
+/*******************************************************************/
+static RF_API_status_t _lr11xx_set_rf_frequency(sfx_u32 frequency_hz) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_FREQUENCY, 0, frequency_hz);
+#endif
+    lr11xx_status = lr11xx_radio_set_rf_freq(SIGFOX_NULL, frequency_hz);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+    }
+errors:
+    SIGFOX_RETURN();
+}
+
+#ifdef LR11XX_RF_API_REG_MODE_POLICY
+/*******************************************************************/
+static RF_API_status_t _lr11xx_apply_reg_mode_policy(RF_API_mode_t rf_mode, RF_API_modulation_t modulation) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+    lr11xx_system_reg_mode_t reg_mode = LR11XX_SYSTEM_REG_MODE_LDO;
+#ifdef LR11XX_HW_API_STATIC_CONFIG
+    const LR11XX_HW_API_reg_mode_cfg_t *reg_mode_cfg = &LR11XX_RF_API_REG_MODE_CFG;
+#else
+    const LR11XX_HW_API_reg_mode_cfg_t *reg_mode_cfg = &(lr1110_ctx.reg_mode_cfg);
+#endif
+    // DC-DC for the TX and the downlink window, LDO for the short carrier sense windows.
+    if (reg_mode_cfg->has_dcdc != 0) {
+        if (rf_mode == RF_API_MODE_TX) {
+            reg_mode = LR11XX_SYSTEM_REG_MODE_DCDC;
+        }
+        if ((rf_mode == RF_API_MODE_RX) && (modulation == RF_API_MODULATION_GFSK) && (reg_mode_cfg->rx_dcdc != 0)) {
+            reg_mode = LR11XX_SYSTEM_REG_MODE_DCDC;
+        }
+    }
+    // Regulator mode is only changed in standby, which is the chip state when the radio is configured.
+    if (reg_mode != lr1110_ctx.reg_mode) {
+        lr11xx_status = lr11xx_system_set_reg_mode(SIGFOX_NULL, reg_mode);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+        }
+        lr1110_ctx.reg_mode = reg_mode;
+    }
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+/*******************************************************************/
+static RF_API_status_t _lr11xx_set_tx_power(sfx_u32 frequency_hz, sfx_s8 tx_power_dbm_eirp) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status = LR11XX_STATUS_OK;
+    lr11xx_radio_pa_cfg_t lr11xx_radio_pa_cfg;
+    LR11XX_HW_API_pa_pwr_cfg_t lr11xx_hw_api_pa_pwr_cfg;
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_get_pa_pwr_cfg(&lr11xx_hw_api_pa_pwr_cfg, frequency_hz, tx_power_dbm_eirp);
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_get_pa_pwr_cfg(&lr11xx_hw_api_pa_pwr_cfg, frequency_hz, tx_power_dbm_eirp);
+#endif
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_PA_CONFIG, (sfx_u8) tx_power_dbm_eirp,
+        ((sfx_u32) ((sfx_u8) lr11xx_hw_api_pa_pwr_cfg.power)) | ((sfx_u32) ((lr11xx_hw_api_pa_pwr_cfg.pa_config.pa_sel & 0x0F) | (lr11xx_hw_api_pa_pwr_cfg.pa_config.pa_reg_supply << 4)) << 8) | ((sfx_u32) lr11xx_hw_api_pa_pwr_cfg.pa_config.pa_duty_cycle << 16) | ((sfx_u32) lr11xx_hw_api_pa_pwr_cfg.pa_config.pa_hp_sel << 24));
+#endif
+    switch (lr11xx_hw_api_pa_pwr_cfg.pa_config.pa_sel) {
+    case LR11XX_HW_API_RADIO_PA_SEL_LP:
+        lr11xx_radio_pa_cfg.pa_sel = LR11XX_RADIO_PA_SEL_LP;
+        break;
+    case LR11XX_HW_API_RADIO_PA_SEL_HP:
+        lr11xx_radio_pa_cfg.pa_sel = LR11XX_RADIO_PA_SEL_HP;
+        break;
+    case LR11XX_HW_API_RADIO_PA_SEL_HF:
+        if (LR11XX_RF_API_CHIP_VARIANT_PROFILE[lr1110_ctx.chip_variant].hf_pa == SIGFOX_FALSE) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_VARIANT);
+        }
+        lr11xx_radio_pa_cfg.pa_sel = LR11XX_RADIO_PA_SEL_HF;
+        break;
+    default:
+        lr11xx_status = LR11XX_STATUS_ERROR;
+        break;
+    }
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+    }
+    switch (lr11xx_hw_api_pa_pwr_cfg.pa_config.pa_reg_supply) {
+    case LR11XX_HW_API_RADIO_PA_REG_SUPPLY_VREG:
+        lr11xx_radio_pa_cfg.pa_reg_supply = LR11XX_RADIO_PA_REG_SUPPLY_VREG;
+        break;
+    case LR11XX_HW_API_RADIO_PA_REG_SUPPLY_VBAT:
+        lr11xx_radio_pa_cfg.pa_reg_supply = LR11XX_RADIO_PA_REG_SUPPLY_VBAT;
+        break;
+    default:
+        lr11xx_status = LR11XX_STATUS_ERROR;
+        break;
+    }
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+    }
+    lr11xx_radio_pa_cfg.pa_hp_sel = lr11xx_hw_api_pa_pwr_cfg.pa_config.pa_hp_sel;
+    lr11xx_radio_pa_cfg.pa_duty_cycle = lr11xx_hw_api_pa_pwr_cfg.pa_config.pa_duty_cycle;
+    lr11xx_status = lr11xx_radio_set_pa_cfg(SIGFOX_NULL, &lr11xx_radio_pa_cfg);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+    }
+    lr11xx_status = lr11xx_radio_set_tx_params(SIGFOX_NULL, lr11xx_hw_api_pa_pwr_cfg.power, LR11XX_RADIO_RAMP_208_US);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+    }
+errors:
+    SIGFOX_RETURN();
+}
+
+#ifdef LR11XX_RF_API_ADAPTIVE_TX_POWER
+/*******************************************************************/
+static LR11XX_RF_API_rssi_history_t *_lr11xx_get_rssi_history(sfx_u32 frequency_hz, sfx_bool create) {
+    LR11XX_RF_API_rssi_history_t *rssi_history = SIGFOX_NULL;
+    sfx_u8 rc_index = 0;
+    sfx_u16 band_index = (sfx_u16) (frequency_hz / LR11XX_RF_API_RSSI_HISTORY_BAND_WIDTH_HZ);
+    sfx_u8 idx = 0;
+#ifdef LR11XX_RF_API_RC_PROFILES
+    rc_index = lr1110_ctx.rc_profile_index;
+#endif
+    for (idx = 0; idx < LR11XX_RF_API_ADAPTIVE_TX_POWER_BANDS; idx++) {
+        rssi_history = &(lr1110_ctx.rssi_history[idx]);
+        if ((rssi_history->rssi_count != 0) && (rssi_history->rc_index == rc_index) && (rssi_history->band_index == band_index)) {
+            return rssi_history;
+        }
+    }
+    if (create == SIGFOX_FALSE) {
+        return SIGFOX_NULL;
+    }
+    // Use a free entry or replace the oldest band.
+    for (idx = 0; idx < LR11XX_RF_API_ADAPTIVE_TX_POWER_BANDS; idx++) {
+        if (lr1110_ctx.rssi_history[idx].rssi_count == 0) {
+            break;
+        }
+    }
+    if (idx >= LR11XX_RF_API_ADAPTIVE_TX_POWER_BANDS) {
+        idx = lr1110_ctx.rssi_history_next_band;
+        lr1110_ctx.rssi_history_next_band = (sfx_u8) ((lr1110_ctx.rssi_history_next_band + 1) % LR11XX_RF_API_ADAPTIVE_TX_POWER_BANDS);
+    }
+    rssi_history = &(lr1110_ctx.rssi_history[idx]);
+    rssi_history->rc_index = rc_index;
+    rssi_history->band_index = band_index;
+    rssi_history->rssi_count = 0;
+    rssi_history->rssi_index = 0;
+    rssi_history->power_reduction_db = 0;
+    return rssi_history;
+}
+#endif
+
+#ifdef LR11XX_RF_API_ADAPTIVE_TX_POWER
+/*******************************************************************/
+static sfx_s8 _lr11xx_default_tx_power_policy(const LR11XX_RF_API_rssi_history_t *rssi_history, sfx_s8 tx_power_dbm_eirp) {
+    sfx_s16 rssi_min_dbm = 0;
+    sfx_u8 idx = 0;
+    // Only reduce the power when the margin has been high on a full history.
+    if (rssi_history->rssi_count < LR11XX_RF_API_RSSI_HISTORY_SIZE) {
+        return tx_power_dbm_eirp;
+    }
+    rssi_min_dbm = rssi_history->rssi_dbm[0];
+    for (idx = 1; idx < LR11XX_RF_API_RSSI_HISTORY_SIZE; idx++) {
+        if (rssi_history->rssi_dbm[idx] < rssi_min_dbm) {
+            rssi_min_dbm = rssi_history->rssi_dbm[idx];
+        }
+    }
+    if (rssi_min_dbm <= LR11XX_RF_API_ADAPTIVE_TX_POWER_TARGET_RSSI_DBM) {
+        return tx_power_dbm_eirp;
+    }
+    if ((rssi_min_dbm - LR11XX_RF_API_ADAPTIVE_TX_POWER_TARGET_RSSI_DBM) >= LR11XX_RF_API_ADAPTIVE_TX_POWER_REDUCTION_MAX_DB) {
+        return (sfx_s8) (tx_power_dbm_eirp - LR11XX_RF_API_ADAPTIVE_TX_POWER_REDUCTION_MAX_DB);
+    }
+    return (sfx_s8) (tx_power_dbm_eirp - (rssi_min_dbm - LR11XX_RF_API_ADAPTIVE_TX_POWER_TARGET_RSSI_DBM));
+}
+#endif
+
+#ifdef LR11XX_RF_API_ADAPTIVE_TX_POWER
+/*******************************************************************/
+static void _lr11xx_add_rssi_sample(sfx_s16 rssi_dbm) {
+    LR11XX_RF_API_rssi_history_t *rssi_history = _lr11xx_get_rssi_history(lr1110_ctx.ul_frequency_hz, SIGFOX_TRUE);
+    sfx_s8 tx_power_dbm_eirp = 0;
+    sfx_s16 power_reduction_db = 0;
+    rssi_history->rssi_dbm[rssi_history->rssi_index] = rssi_dbm;
+    rssi_history->rssi_index = (sfx_u8) ((rssi_history->rssi_index + 1) % LR11XX_RF_API_RSSI_HISTORY_SIZE);
+    if (rssi_history->rssi_count < LR11XX_RF_API_RSSI_HISTORY_SIZE) {
+        rssi_history->rssi_count++;
+    }
+    if (lr1110_ctx.tx_power_policy_cb != SIGFOX_NULL) {
+        tx_power_dbm_eirp = lr1110_ctx.tx_power_policy_cb(rssi_history, lr1110_ctx.ul_tx_power_dbm_eirp);
+    } else {
+        tx_power_dbm_eirp = _lr11xx_default_tx_power_policy(rssi_history, lr1110_ctx.ul_tx_power_dbm_eirp);
+    }
+    // Never exceed the power requested by the core library.
+    power_reduction_db = (sfx_s16) (lr1110_ctx.ul_tx_power_dbm_eirp - tx_power_dbm_eirp);
+    if (power_reduction_db < 0) {
+        power_reduction_db = 0;
+    }
+    if (power_reduction_db > LR11XX_RF_API_ADAPTIVE_TX_POWER_REDUCTION_MAX_DB) {
+        power_reduction_db = LR11XX_RF_API_ADAPTIVE_TX_POWER_REDUCTION_MAX_DB;
+    }
+    if ((power_reduction_db < rssi_history->power_reduction_db) || (power_reduction_db >= (rssi_history->power_reduction_db + LR11XX_RF_API_ADAPTIVE_TX_POWER_HYSTERESIS_DB))) {
+        rssi_history->power_reduction_db = (sfx_u8) power_reduction_db;
+    }
+}
+#endif
+
+#ifdef LR11XX_RF_API_ADAPTIVE_TX_POWER
+/*******************************************************************/
+static sfx_s8 _lr11xx_get_adaptive_tx_power(sfx_u32 frequency_hz, sfx_s8 tx_power_dbm_eirp) {
+    LR11XX_RF_API_rssi_history_t *rssi_history = _lr11xx_get_rssi_history(frequency_hz, SIGFOX_FALSE);
+    sfx_s8 adaptive_tx_power_dbm_eirp = tx_power_dbm_eirp;
+#ifdef LR11XX_HW_API_STATIC_CONFIG
+    const LR11XX_HW_API_pa_pwr_band_t *band = _lr11xx_get_pa_pwr_band(frequency_hz);
+    sfx_s8 reduced_tx_power_dbm_eirp = tx_power_dbm_eirp;
+    sfx_u8 idx = 0;
+#endif
+    // Save the uplink parameters to index the downlink RSSI of this sequence.
+    lr1110_ctx.ul_frequency_hz = frequency_hz;
+    lr1110_ctx.ul_tx_power_dbm_eirp = tx_power_dbm_eirp;
+    if ((rssi_history != SIGFOX_NULL) && (rssi_history->power_reduction_db != 0)) {
+#ifdef LR11XX_HW_API_STATIC_CONFIG
+        // Use the lowest entry of the PA table of the band which still provides the reduced power.
+        reduced_tx_power_dbm_eirp = (sfx_s8) (tx_power_dbm_eirp - rssi_history->power_reduction_db);
+        for (idx = ((band == SIGFOX_NULL) ? 0 : band->first_entry); idx < ((band == SIGFOX_NULL) ? 0 : (band->first_entry + band->entry_count)); idx++) {
+            if ((LR11XX_RF_API_PA_PWR_TABLE[idx].expected_output_pwr_in_dbm >= reduced_tx_power_dbm_eirp) && (LR11XX_RF_API_PA_PWR_TABLE[idx].expected_output_pwr_in_dbm < adaptive_tx_power_dbm_eirp)) {
+                adaptive_tx_power_dbm_eirp = LR11XX_RF_API_PA_PWR_TABLE[idx].expected_output_pwr_in_dbm;
+            }
+        }
+#else
+        adaptive_tx_power_dbm_eirp = (sfx_s8) (tx_power_dbm_eirp - rssi_history->power_reduction_db);
+#endif
+    }
+    return adaptive_tx_power_dbm_eirp;
+}
+#endif
+
+#ifdef LR11XX_RF_API_BULK_MODE
+/*******************************************************************/
+static sfx_bool _lr11xx_bulk_radio_parameters_equal(const RF_API_radio_parameters_t *radio_parameters, sfx_s8 tx_power_dbm_eirp) {
+    const RF_API_radio_parameters_t *applied = &(lr1110_ctx.bulk_radio_parameters);
+    // Frequency is not part of the comparison since it is always programmed.
+    if ((lr1110_ctx.bulk_radio_valid == SIGFOX_FALSE) || (radio_parameters->rf_mode != applied->rf_mode) || (radio_parameters->modulation != applied->modulation) || (radio_parameters->bit_rate_bps != applied->bit_rate_bps)) {
+        return SIGFOX_FALSE;
+    }
+    if ((radio_parameters->rf_mode == RF_API_MODE_TX) && (tx_power_dbm_eirp != applied->tx_power_dbm_eirp)) {
+        return SIGFOX_FALSE;
+    }
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    if ((radio_parameters->modulation == RF_API_MODULATION_GFSK) && (radio_parameters->deviation_hz != applied->deviation_hz)) {
+        return SIGFOX_FALSE;
+    }
+#endif
+    return SIGFOX_TRUE;
+}
+#endif
+
+/*******************************************************************/
+static void _lr11xx_get_dbpsk_ramp_delays(sfx_u16 bit_rate_bps, sfx_u16 *ramp_up_delay_us, sfx_u16 *ramp_down_delay_us) {
+    (*ramp_up_delay_us) = 0;
+    (*ramp_down_delay_us) = 0;
+    if (bit_rate_bps == 100) {
+        (*ramp_up_delay_us) = LR11XX_RADIO_SIGFOX_DBPSK_RAMP_UP_TIME_100_BPS;
+        (*ramp_down_delay_us) = LR11XX_RADIO_SIGFOX_DBPSK_RAMP_DOWN_TIME_100_BPS;
+    } else if (bit_rate_bps == 600) {
+        (*ramp_up_delay_us) = LR11XX_RADIO_SIGFOX_DBPSK_RAMP_UP_TIME_600_BPS;
+        (*ramp_down_delay_us) = LR11XX_RADIO_SIGFOX_DBPSK_RAMP_DOWN_TIME_600_BPS;
+    }
+}
+
+/*******************************************************************/
+static sfx_u32 _lr11xx_compute_ul_airtime_us(sfx_u8 bitstream_size_bytes, sfx_u16 bit_rate_bps) {
+    sfx_u16 ramp_up_delay_us = 0;
+    sfx_u16 ramp_down_delay_us = 0;
+    sfx_u32 airtime_us = 0;
+    _lr11xx_get_dbpsk_ramp_delays(bit_rate_bps, &ramp_up_delay_us, &ramp_down_delay_us);
+    // Encoded payload (including tail bits) and BPSK ramps.
+    airtime_us = (((sfx_u32) dbpsk_get_pld_len_in_bits(bitstream_size_bytes * 8)) * 1000000) / ((sfx_u32) bit_rate_bps);
+    airtime_us += ((sfx_u32) ramp_up_delay_us) + ((sfx_u32) ramp_down_delay_us);
+    return airtime_us;
+}
+
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+/*******************************************************************/
+static sfx_u32 _lr11xx_compute_dl_airtime_us(sfx_u16 bit_rate_bps) {
+    // Preamble, synchronization word and fixed length payload.
+    return (((sfx_u32) (LR11XX_RF_API_DL_PREAMBLE_SIZE_BITS + (SIGFOX_DL_FT_SIZE_BYTES * 8) + (SIGFOX_DL_PHY_CONTENT_SIZE_BYTES * 8))) * 1000000) / ((sfx_u32) bit_rate_bps);
+}
+#endif
+
+/*******************************************************************/
+static RF_API_status_t _lr11xx_write_dbpsk_frame(const sfx_u8 *bitstream, sfx_u8 bitstream_size_bytes) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+#if (defined SIGFOX_EP_ERROR_CODES) && ((defined LR11XX_RF_API_HAL_TX_BUFFER) || (defined LR11XX_RF_API_ASYNC_HAL))
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+    lr11xx_radio_pkt_params_bpsk_t lr11xx_radio_pkt_params_bpsk;
+    lr11xx_status_t lr11xx_status;
+    dbpsk_encoder_t dbpsk_encoder;
+#ifdef LR11XX_RF_API_HAL_TX_BUFFER
+    sfx_u8 *buffer = SIGFOX_NULL;
+#elif (defined LR11XX_RF_API_ASYNC_HAL)
+    // Must remain valid until the end of the asynchronous transfer.
+    sfx_u8 *buffer = lr1110_ctx.tx_buffer;
+#else
+    sfx_u8 buffer[SIGFOX_UL_BITSTREAM_SIZE_BYTES + 1];
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (bitstream_size_bytes > SIGFOX_UL_BITSTREAM_SIZE_BYTES) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_BUFFER_SIZE);
+    }
+#endif
+    // Bit rate is set by the DBPSK configuration (init or sweep).
+    if (lr1110_ctx.backup_bit_rate_bps_patch == 0) {
+#ifdef LR11XX_RF_API_STATISTICS
+        lr1110_ctx.stats.state_error_count++;
+#endif
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_STATE);
+    }
+    /*Set the BPSK packet param*/
+    lr11xx_radio_pkt_params_bpsk.pld_len_in_bits = (sfx_u16) dbpsk_get_pld_len_in_bits(bitstream_size_bytes * 8);
+    lr11xx_radio_pkt_params_bpsk.pld_len_in_bytes = (sfx_u8) dbpsk_get_pld_len_in_bytes(bitstream_size_bytes * 8);
+#ifdef LR11XX_RF_API_HAL_TX_BUFFER
+    // Encode directly in the SPI payload stage of the HAL.
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_get_tx_buffer(&buffer, lr11xx_radio_pkt_params_bpsk.pld_len_in_bytes);
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_get_tx_buffer(&buffer, lr11xx_radio_pkt_params_bpsk.pld_len_in_bytes);
+#endif
+    if (buffer == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // The bitstream is read once and encoded out of place, the tail bits are appended by the encoder.
+    // The packet length given to the chip (dbpsk_get_pld_len_in_bits) ends right after the tail bits.
+    dbpsk_encoder_init(&dbpsk_encoder);
+    dbpsk_encode_chunk(&dbpsk_encoder, bitstream, bitstream_size_bytes, buffer);
+    dbpsk_encode_tail(&dbpsk_encoder, LR11XX_RF_API_DBPSK_TAIL_BYTE, LR11XX_RF_API_DBPSK_TAIL_SIZE_BITS, &(buffer[bitstream_size_bytes]));
+    _lr11xx_get_dbpsk_ramp_delays(lr1110_ctx.backup_bit_rate_bps_patch, &lr11xx_radio_pkt_params_bpsk.ramp_up_delay, &lr11xx_radio_pkt_params_bpsk.ramp_down_delay);
+    // TX watchdog used by the next lr11xx_radio_set_tx() calls.
+    lr1110_ctx.tx_timeout_ms = ((_lr11xx_compute_ul_airtime_us(bitstream_size_bytes, lr1110_ctx.backup_bit_rate_bps_patch) + 999) / 1000) + LR11XX_RF_API_TX_TIMEOUT_MARGIN_MS;
+    lr11xx_status = lr11xx_radio_set_bpsk_pkt_params(SIGFOX_NULL, &lr11xx_radio_pkt_params_bpsk);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+    }
+#ifdef LR11XX_RF_API_ASYNC_HAL
+    if (lr1110_ctx.hal_operation == HAL_OPERATION_WRITE_TX_BUFFER) {
+        // The next step is triggered by the completion callback.
+        lr1110_ctx.hal_command[0] = (sfx_u8) (LR11XX_RF_API_WRITE_BUFFER8_OPCODE >> 8);
+        lr1110_ctx.hal_command[1] = (sfx_u8) (LR11XX_RF_API_WRITE_BUFFER8_OPCODE >> 0);
+#ifdef SIGFOX_EP_ERROR_CODES
+        lr11xx_hw_api_status = LR11XX_HW_API_write_async(lr1110_ctx.hal_command, LR11XX_RF_API_WRITE_BUFFER8_CMD_SIZE_BYTES, buffer, lr11xx_radio_pkt_params_bpsk.pld_len_in_bytes, &_lr11xx_hal_cplt_callback);
+        LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+        LR11XX_HW_API_write_async(lr1110_ctx.hal_command, LR11XX_RF_API_WRITE_BUFFER8_CMD_SIZE_BYTES, buffer, lr11xx_radio_pkt_params_bpsk.pld_len_in_bytes, &_lr11xx_hal_cplt_callback);
+#endif
+        SIGFOX_RETURN();
+    }
+#endif
+    lr11xx_status = lr11xx_regmem_write_buffer8(SIGFOX_NULL, buffer, lr11xx_radio_pkt_params_bpsk.pld_len_in_bytes);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_REGMEM_REG);
+    }
+errors:
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+static RF_API_status_t _lr11xx_start_tx(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_tx_on();
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_tx_on();
+#endif
+#ifdef LR11XX_RF_API_ERROR_RECOVERY
+    lr1110_ctx.radio_cmd = RADIO_CMD_TX;
+#endif
+    lr11xx_status = lr11xx_radio_set_tx(SIGFOX_NULL, lr1110_ctx.tx_timeout_ms);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+    }
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats.tx_frame_count++;
+#endif
+errors:
+    SIGFOX_RETURN();
+}
+
+#ifdef LR11XX_RF_API_SWEEP
+/*******************************************************************/
+static RF_API_status_t _lr11xx_sweep_send_frame(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+    lr1110_ctx.tx_done_flag = 0;
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_write_dbpsk_frame(LR11XX_RF_API_SWEEP_PATTERN, LR11XX_RF_API_SWEEP_PATTERN_SIZE_BYTES);
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_write_dbpsk_frame(LR11XX_RF_API_SWEEP_PATTERN, LR11XX_RF_API_SWEEP_PATTERN_SIZE_BYTES);
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_tx_on();
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_tx_on();
+#endif
+    lr11xx_status = lr11xx_radio_set_tx(SIGFOX_NULL, lr1110_ctx.tx_timeout_ms);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+    }
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_SWEEP
+/*******************************************************************/
+static RF_API_status_t _lr11xx_sweep_start_point(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+    const LR11XX_RF_API_sweep_point_t *point = &(lr1110_ctx.sweep_config.points[lr1110_ctx.sweep_point_index]);
+    const LR11XX_RF_API_sweep_point_t *previous_point = SIGFOX_NULL;
+    sfx_u32 frame_duration_ms = 0;
+    if (lr1110_ctx.sweep_point_index > 0) {
+        previous_point = &(lr1110_ctx.sweep_config.points[lr1110_ctx.sweep_point_index - 1]);
+    }
+    // Only send the parameters which differ from the previous point.
+    if ((previous_point == SIGFOX_NULL) || (previous_point->frequency_hz != point->frequency_hz)) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_set_rf_frequency(point->frequency_hz);
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_set_rf_frequency(point->frequency_hz);
+#endif
+    }
+    // PA configuration depends on the frequency as well as on the output power.
+    if ((previous_point == SIGFOX_NULL) || (previous_point->frequency_hz != point->frequency_hz) || (previous_point->tx_power_dbm_eirp != point->tx_power_dbm_eirp)) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_set_tx_power(point->frequency_hz, point->tx_power_dbm_eirp);
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_set_tx_power(point->frequency_hz, point->tx_power_dbm_eirp);
+#endif
+    }
+    if (lr1110_ctx.sweep_config.mode == LR11XX_RF_API_SWEEP_MODE_CW) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        lr11xx_hw_api_status = LR11XX_HW_API_tx_on();
+        LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+        LR11XX_HW_API_tx_on();
+#endif
+        lr11xx_status = lr11xx_radio_set_tx_cw(SIGFOX_NULL);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+        }
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+#ifdef SIGFOX_EP_ERROR_CODES
+        lr11xx_hw_api_status = LR11XX_HW_API_timer_start(point->dwell_ms);
+        LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+        LR11XX_HW_API_timer_start(point->dwell_ms);
+#endif
+#endif
+    } else {
+        // Repeat the test pattern as many times as it fits in the dwell time.
+        frame_duration_ms = _lr11xx_compute_ul_airtime_us(LR11XX_RF_API_SWEEP_PATTERN_SIZE_BYTES, lr1110_ctx.sweep_config.bit_rate_bps) / 1000;
+        lr1110_ctx.sweep_frame_count = (point->dwell_ms / frame_duration_ms);
+        if (lr1110_ctx.sweep_frame_count == 0) {
+            lr1110_ctx.sweep_frame_count = 1;
+        }
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_sweep_send_frame();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_sweep_send_frame();
+#endif
+    }
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_SWEEP
+/*******************************************************************/
+static RF_API_status_t _lr11xx_sweep_next_point(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+    // Leave TX mode before updating the radio parameters.
+    lr11xx_status = lr11xx_system_set_standby(SIGFOX_NULL, LR11XX_SYSTEM_STANDBY_CFG_XOSC);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
+    if (lr1110_ctx.sweep_config.mode == LR11XX_RF_API_SWEEP_MODE_CW) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        lr11xx_hw_api_status = LR11XX_HW_API_tx_off();
+        LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+        LR11XX_HW_API_tx_off();
+#endif
+    }
+    lr1110_ctx.sweep_point_index++;
+    if (lr1110_ctx.sweep_point_index < lr1110_ctx.sweep_config.number_of_points) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_sweep_start_point();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_sweep_start_point();
+#endif
+    } else {
+        lr1110_ctx.sweep_running = SIGFOX_FALSE;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+        if (lr1110_ctx.sweep_config.cplt_cb != SIGFOX_NULL) {
+            lr1110_ctx.sweep_config.cplt_cb();
+        }
+#endif
+    }
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_SPECTRUM_SCAN
+/*******************************************************************/
+static RF_API_status_t _lr11xx_scan_start_channel(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+#endif
+    lr11xx_status_t lr11xx_status;
+    sfx_u32 frequency_hz = 0;
+    if (lr1110_ctx.scan_config.frequencies_hz != SIGFOX_NULL) {
+        frequency_hz = lr1110_ctx.scan_config.frequencies_hz[lr1110_ctx.scan_channel_index];
+    } else {
+        frequency_hz = lr1110_ctx.scan_config.start_frequency_hz + ((sfx_u32) lr1110_ctx.scan_channel_index * lr1110_ctx.scan_config.step_hz);
+    }
+    // Only the frequency changes between two channels, it can be updated in standby mode only.
+    lr11xx_status = lr11xx_system_set_standby(SIGFOX_NULL, LR11XX_SYSTEM_STANDBY_CFG_XOSC);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_set_rf_frequency(frequency_hz);
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_set_rf_frequency(frequency_hz);
+#endif
+    lr11xx_status = lr11xx_radio_set_rx_with_timeout_in_rtc_step(SIGFOX_NULL, 0xFFFFFF);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+    }
+    lr1110_ctx.scan_sample_count = 0;
+    lr1110_ctx.scan_rssi_sum = 0;
+    lr1110_ctx.scan_rssi_min = 0x7FFF;
+    lr1110_ctx.scan_rssi_max = -0x8000;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_timer_start(lr1110_ctx.scan_config.sample_period_ms);
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_timer_start(lr1110_ctx.scan_config.sample_period_ms);
+#endif
+#endif
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_SPECTRUM_SCAN
+/*******************************************************************/
+static RF_API_status_t _lr11xx_scan_sample(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+    LR11XX_RF_API_scan_result_t *result = SIGFOX_NULL;
+    sfx_s8 rssi_dbm = 0;
+    lr11xx_status = lr11xx_radio_get_rssi_inst(SIGFOX_NULL, &rssi_dbm);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+    }
+    lr1110_ctx.scan_rssi_sum += rssi_dbm;
+    if (rssi_dbm < lr1110_ctx.scan_rssi_min) {
+        lr1110_ctx.scan_rssi_min = rssi_dbm;
+    }
+    if (rssi_dbm > lr1110_ctx.scan_rssi_max) {
+        lr1110_ctx.scan_rssi_max = rssi_dbm;
+    }
+    lr1110_ctx.scan_sample_count++;
+    if (lr1110_ctx.scan_sample_count < lr1110_ctx.scan_samples_per_channel) {
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+#ifdef SIGFOX_EP_ERROR_CODES
+        lr11xx_hw_api_status = LR11XX_HW_API_timer_start(lr1110_ctx.scan_config.sample_period_ms);
+        LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+        LR11XX_HW_API_timer_start(lr1110_ctx.scan_config.sample_period_ms);
+#endif
+#endif
+        goto errors;
+    }
+    // Channel completed.
+    result = &(lr1110_ctx.scan_config.results[lr1110_ctx.scan_channel_index]);
+    result->rssi_min_dbm = lr1110_ctx.scan_rssi_min;
+    result->rssi_max_dbm = lr1110_ctx.scan_rssi_max;
+    result->rssi_mean_dbm = (sfx_s16) (lr1110_ctx.scan_rssi_sum / (sfx_s32) lr1110_ctx.scan_sample_count);
+    lr1110_ctx.scan_channel_index++;
+    if (lr1110_ctx.scan_channel_index < lr1110_ctx.scan_config.number_of_channels) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_scan_start_channel();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_scan_start_channel();
+#endif
+    } else {
+        lr11xx_status = lr11xx_system_set_standby(SIGFOX_NULL, LR11XX_SYSTEM_STANDBY_CFG_XOSC);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+        }
+#ifdef SIGFOX_EP_ERROR_CODES
+        lr11xx_hw_api_status = LR11XX_HW_API_rx_off();
+        LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+        LR11XX_HW_API_rx_off();
+#endif
+        lr1110_ctx.scan_running = SIGFOX_FALSE;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+        if (lr1110_ctx.scan_config.cplt_cb != SIGFOX_NULL) {
+            lr1110_ctx.scan_config.cplt_cb();
+        }
+#endif
+    }
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#if (defined SIGFOX_EP_BIDIRECTIONAL) && (defined LR11XX_RF_API_DL_VALIDATION)
+/*******************************************************************/
+static RF_API_status_t _lr11xx_validate_dl_frame(sfx_bool *dl_frame_valid) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+#ifdef LR11XX_RF_API_ASYNC_HAL
+    // Frame has already been read by the asynchronous transfer.
+    sfx_u8 *dl_phy_content = lr1110_ctx.dl_phy_content;
+#else
+    lr11xx_radio_rx_buffer_status_t lr11xx_radio_rx_buffer_status;
+    sfx_u8 dl_phy_content[SIGFOX_DL_PHY_CONTENT_SIZE_BYTES];
+#endif
+    (*dl_frame_valid) = SIGFOX_TRUE;
+    if (lr1110_ctx.dl_validation_cb != SIGFOX_NULL) {
+#ifndef LR11XX_RF_API_ASYNC_HAL
+        // The frame is left in the RX buffer to be read again by LR11XX_RF_API_get_dl_phy_content_and_rssi().
+        lr11xx_status = lr11xx_radio_get_rx_buffer_status(SIGFOX_NULL, &lr11xx_radio_rx_buffer_status);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+        }
+        lr11xx_status = lr11xx_regmem_read_buffer8(SIGFOX_NULL, dl_phy_content, lr11xx_radio_rx_buffer_status.buffer_start_pointer, SIGFOX_DL_PHY_CONTENT_SIZE_BYTES);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_REGMEM_REG);
+        }
+#endif
+        (*dl_frame_valid) = lr1110_ctx.dl_validation_cb(dl_phy_content, SIGFOX_DL_PHY_CONTENT_SIZE_BYTES);
+    }
+    if ((*dl_frame_valid) == SIGFOX_FALSE) {
+        // False sync word detection: drop the frame and listen again with the same configuration.
+        lr1110_ctx.dl_rejected_count++;
+        lr11xx_status = lr11xx_regmem_clear_rxbuffer(SIGFOX_NULL);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_REGMEM_REG);
+        }
+        lr11xx_status = lr11xx_radio_set_rx_with_timeout_in_rtc_step(SIGFOX_NULL, 0xFFFFFF);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+        }
+    }
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+/*******************************************************************/
+static RF_API_status_t _lr11xx_rx_done(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+#ifdef LR11XX_RF_API_ERROR_RECOVERY
+    lr1110_ctx.radio_cmd = RADIO_CMD_NONE;
+    lr1110_ctx.recovery_info.consecutive_recovery_count = 0;
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_rx_off();
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_rx_off();
+#endif
+    lr1110_ctx.rx_done_flag = 1;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    if (lr1110_ctx.callbacks.rx_data_received_cb != SIGFOX_NULL) {
+        lr1110_ctx.callbacks.rx_data_received_cb();
+    }
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#if (defined SIGFOX_EP_BIDIRECTIONAL) && (defined LR11XX_RF_API_ASYNC_HAL)
+/*******************************************************************/
+static RF_API_status_t _lr11xx_read_dl_frame(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+    lr11xx_radio_rx_buffer_status_t lr11xx_radio_rx_buffer_status;
+    lr11xx_status = lr11xx_radio_get_rx_buffer_status(SIGFOX_NULL, &lr11xx_radio_rx_buffer_status);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+    }
+    lr1110_ctx.hal_command[0] = (sfx_u8) (LR11XX_RF_API_READ_BUFFER8_OPCODE >> 8);
+    lr1110_ctx.hal_command[1] = (sfx_u8) (LR11XX_RF_API_READ_BUFFER8_OPCODE >> 0);
+    lr1110_ctx.hal_command[2] = lr11xx_radio_rx_buffer_status.buffer_start_pointer;
+    lr1110_ctx.hal_command[3] = SIGFOX_DL_PHY_CONTENT_SIZE_BYTES;
+    // The reception is completed by the process function once the frame has been read.
+    lr1110_ctx.hal_operation = HAL_OPERATION_READ_RX_BUFFER;
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_read_async(lr1110_ctx.hal_command, LR11XX_RF_API_READ_BUFFER8_CMD_SIZE_BYTES, lr1110_ctx.dl_phy_content, SIGFOX_DL_PHY_CONTENT_SIZE_BYTES, &_lr11xx_hal_cplt_callback);
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_read_async(lr1110_ctx.hal_command, LR11XX_RF_API_READ_BUFFER8_CMD_SIZE_BYTES, lr1110_ctx.dl_phy_content, SIGFOX_DL_PHY_CONTENT_SIZE_BYTES, &_lr11xx_hal_cplt_callback);
+#endif
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_ASYNC_HAL
+/*******************************************************************/
+static RF_API_status_t _lr11xx_hal_transfer_done(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+#if (defined SIGFOX_EP_BIDIRECTIONAL) && (defined LR11XX_RF_API_DL_VALIDATION)
+    sfx_bool dl_frame_valid = SIGFOX_TRUE;
+#endif
+    hal_operation_t hal_operation = lr1110_ctx.hal_operation;
+    lr1110_ctx.hal_operation = HAL_OPERATION_NONE;
+    if (hal_operation == HAL_OPERATION_WRITE_TX_BUFFER) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_start_tx();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_start_tx();
+#endif
+    }
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    if (hal_operation == HAL_OPERATION_READ_RX_BUFFER) {
+#ifdef LR11XX_RF_API_DL_VALIDATION
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_validate_dl_frame(&dl_frame_valid);
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_validate_dl_frame(&dl_frame_valid);
+#endif
+        if (dl_frame_valid == SIGFOX_FALSE) {
+            // Reception has been re-armed: the core library is not woken up.
+            SIGFOX_RETURN();
+        }
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_rx_done();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_rx_done();
+#endif
+    }
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_SWEEP
+/*******************************************************************/
+static RF_API_status_t _lr11xx_sweep_frame_done(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+    if (lr1110_ctx.sweep_frame_count > 1) {
+        lr1110_ctx.sweep_frame_count--;
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_sweep_send_frame();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_sweep_send_frame();
+#endif
+    } else {
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_sweep_next_point();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_sweep_next_point();
+#endif
+    }
+#ifdef SIGFOX_EP_ERROR_CODES
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#if (defined LR11XX_RF_API_COEXISTENCE) || (defined LR11XX_RF_API_ERROR_RECOVERY) || (defined LR11XX_RF_API_POWER_POLICY)
+/*******************************************************************/
+static RF_API_status_t _lr11xx_warm_wake_up(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+    lr11xx_system_errors_t errors;
+    // The chip kept its RF switch, TCXO and calibration settings: only restore the state another user may have changed.
+#ifdef LR11XX_RF_API_BULK_MODE
+    lr1110_ctx.bulk_radio_valid = SIGFOX_FALSE;
+#endif
+    lr11xx_status = lr11xx_system_wakeup(SIGFOX_NULL);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_WAKEUP);
+    }
+#ifdef LR11XX_RF_API_REG_MODE_POLICY
+    // Restore the regulator selected by the policy.
+    lr11xx_status = lr11xx_system_set_reg_mode(SIGFOX_NULL, lr1110_ctx.reg_mode);
+#else
+    lr11xx_status = lr11xx_system_set_reg_mode(SIGFOX_NULL, LR11XX_SYSTEM_REG_MODE_LDO);
+#endif
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
+    lr11xx_status = lr11xx_system_set_standby(SIGFOX_NULL, LR11XX_SYSTEM_STANDBY_CFG_XOSC);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
+#ifdef LR11XX_RF_API_RC_PROFILES
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_apply_rc_profile();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_apply_rc_profile();
+#endif
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_set_irq_config();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_set_irq_config();
+#endif
+    lr11xx_status = lr11xx_system_get_errors(SIGFOX_NULL, &errors);
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_CHIP_ERRORS, (sfx_u8) lr11xx_status, (sfx_u32) errors);
+#endif
+    if ((lr11xx_status != LR11XX_STATUS_OK) || (errors != 0)) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
+errors:
+    SIGFOX_RETURN();
+}
+
+#ifdef LR11XX_RF_API_POWER_POLICY
+/*******************************************************************/
+static RF_API_status_t _lr11xx_enter_gap_mode(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+    lr11xx_system_sleep_cfg_t lr11xx_system_sleep_cfg;
+    LR11XX_HW_API_power_timings_t power_timings;
+    lr1110_ctx.gap_mode = LR11XX_RF_API_GAP_MODE_STANDBY_XOSC;
+    if (lr1110_ctx.gap_hint_ms != 0) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        lr11xx_hw_api_status = LR11XX_HW_API_get_power_timings(&power_timings);
+        LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+        LR11XX_HW_API_get_power_timings(&power_timings);
+#endif
+        // Select the lowest power mode which can be exited before the next frame.
+        if (((power_timings.warm_wake_up_time_us * LR11XX_RF_API_POWER_POLICY_GAP_FACTOR) / 1000) <= lr1110_ctx.gap_hint_ms) {
+            lr1110_ctx.gap_mode = LR11XX_RF_API_GAP_MODE_SLEEP;
+        } else if (((power_timings.xosc_startup_time_us * LR11XX_RF_API_POWER_POLICY_GAP_FACTOR) / 1000) <= lr1110_ctx.gap_hint_ms) {
+            lr1110_ctx.gap_mode = LR11XX_RF_API_GAP_MODE_STANDBY_RC;
+        }
+    }
+    switch (lr1110_ctx.gap_mode) {
+    case LR11XX_RF_API_GAP_MODE_SLEEP:
+        lr11xx_system_sleep_cfg.is_warm_start = 1;
+        lr11xx_system_sleep_cfg.is_rtc_timeout = 0;
+        lr11xx_status = lr11xx_system_set_sleep(SIGFOX_NULL, lr11xx_system_sleep_cfg, 0);
+        break;
+    case LR11XX_RF_API_GAP_MODE_STANDBY_RC:
+        lr11xx_status = lr11xx_system_set_standby(SIGFOX_NULL, LR11XX_SYSTEM_STANDBY_CFG_RC);
+        break;
+    default:
+        lr11xx_status = lr11xx_system_set_standby(SIGFOX_NULL, LR11XX_SYSTEM_STANDBY_CFG_XOSC);
+        break;
+    }
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        lr1110_ctx.gap_mode = LR11XX_RF_API_GAP_MODE_STANDBY_XOSC;
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_POWER_POLICY
+/*******************************************************************/
+static RF_API_status_t _lr11xx_exit_gap_mode(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status = LR11XX_STATUS_OK;
+    switch (lr1110_ctx.gap_mode) {
+    case LR11XX_RF_API_GAP_MODE_SLEEP:
+        lr1110_ctx.gap_mode = LR11XX_RF_API_GAP_MODE_STANDBY_XOSC;
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_warm_wake_up();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_warm_wake_up();
+#endif
+        break;
+    case LR11XX_RF_API_GAP_MODE_STANDBY_RC:
+        // Start the oscillator while the radio is being configured.
+        lr1110_ctx.gap_mode = LR11XX_RF_API_GAP_MODE_STANDBY_XOSC;
+        lr11xx_status = lr11xx_system_set_standby(SIGFOX_NULL, LR11XX_SYSTEM_STANDBY_CFG_XOSC);
+        break;
+    default:
+        break;
+    }
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+#endif
+
+/*** LR11XX RF API functions ***/
+
+#if (defined SIGFOX_EP_ASYNCHRONOUS) || (defined SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE)
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_open(RF_API_config_t *rf_api_config) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+    LR11XX_HW_API_config_t lr11xx_hw_api_config;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    lr1110_ctx.callbacks.process_cb = rf_api_config->process_cb;
+    lr1110_ctx.callbacks.error_cb = rf_api_config->error_cb;
+#else
+    SIGFOX_UNUSED(rf_api_config);
+#endif
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_OPEN;
+#endif
+    // Init board.
+    lr11xx_hw_api_config.rc = (rf_api_config->rc);
+    lr11xx_hw_api_config.gpio_irq_callback = &_lr11xx_gpio_irq_callback;
+#if ((defined LR11XX_RF_API_SWEEP) || (defined LR11XX_RF_API_SPECTRUM_SCAN)) && (defined SIGFOX_EP_ASYNCHRONOUS)
+    lr11xx_hw_api_config.timer_irq_callback = &_lr11xx_timer_callback;
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_open(&lr11xx_hw_api_config);
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_open(&lr11xx_hw_api_config);
+#endif
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    // Keep the records of the previous run when the ring is still valid.
+    if ((lr11xx_flight_recorder.magic != LR11XX_RF_API_FLIGHT_RECORDER_MAGIC) || (lr11xx_flight_recorder.size != LR11XX_RF_API_FLIGHT_RECORDER) || (lr11xx_flight_recorder.index >= LR11XX_RF_API_FLIGHT_RECORDER)) {
+        LR11XX_RF_API_reset_flight_recorder();
+    }
+    _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_ENTRY, LR11XX_RF_API_FUNCTION_OPEN, 0);
+#endif
+#ifdef LR11XX_RF_API_RC_PROFILES
+    // Profile 0 is the RC given at opening.
+    lr1110_ctx.rc_profile_index = 0;
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_load_rc_profile(0, rf_api_config->rc);
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_load_rc_profile(0, rf_api_config->rc);
+#endif
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+errors:
+#endif
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ERROR_CODES)
+    _lr11xx_stats_count_error(status);
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+/*******************************************************************/
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+RF_API_status_t LR11XX_RF_API_process(void) {
+#else
+static RF_API_status_t LR11XX_RF_API_process(void) {
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+    lr11xx_system_irq_mask_t lr11xx_system_irq_mask;
+    lr11xx_status_t lr11xx_status;
+#if (defined SIGFOX_EP_BIDIRECTIONAL) && (defined LR11XX_RF_API_DL_VALIDATION)
+    sfx_bool dl_frame_valid = SIGFOX_TRUE;
+#endif
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ASYNCHRONOUS)
+    // In blocking mode, traffic of the IRQ handling is accounted to the calling function.
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_PROCESS;
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+#ifdef LR11XX_RF_API_ASYNC_HAL
+    if (lr1110_ctx.hal_cplt_flag == 1) {
+        // Buffer transfer started by the previous step is completed.
+        lr1110_ctx.hal_cplt_flag = 0;
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_hal_transfer_done();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_hal_transfer_done();
+#endif
+        if (lr1110_ctx.irq_flag != 1) {
+            SIGFOX_RETURN();
+        }
+    }
+#endif
+#if (defined LR11XX_RF_API_SWEEP) && (defined SIGFOX_EP_ASYNCHRONOUS)
+    if (lr1110_ctx.sweep_timer_flag == 1) {
+        // Dwell time of the current sweep point has elapsed.
+        lr1110_ctx.sweep_timer_flag = 0;
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_sweep_next_point();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_sweep_next_point();
+#endif
+        if (lr1110_ctx.irq_flag != 1) {
+#ifdef LR11XX_RF_API_SHARED_BUS
+            _lr11xx_bus_release();
+#endif
+            SIGFOX_RETURN();
+        }
+    }
+#endif
+#if (defined LR11XX_RF_API_SPECTRUM_SCAN) && (defined SIGFOX_EP_ASYNCHRONOUS)
+    if (lr1110_ctx.scan_timer_flag == 1) {
+        // Sample period of the current channel has elapsed.
+        lr1110_ctx.scan_timer_flag = 0;
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_scan_sample();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_scan_sample();
+#endif
+        if (lr1110_ctx.irq_flag != 1) {
+#ifdef LR11XX_RF_API_SHARED_BUS
+            _lr11xx_bus_release();
+#endif
+            SIGFOX_RETURN();
+        }
+    }
+#endif
+    if (lr1110_ctx.irq_flag != 1) {
+#ifdef LR11XX_RF_API_STATISTICS
+        lr1110_ctx.stats.state_error_count++;
+#endif
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_STATE);
+    }
+    lr1110_ctx.irq_flag = 0;
+
+    lr11xx_status = lr11xx_system_get_and_clear_irq_status(SIGFOX_NULL, &lr11xx_system_irq_mask);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
+#ifdef LR11XX_RF_API_STATISTICS
+    _lr11xx_stats_count_irq(lr11xx_system_irq_mask);
+#endif
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_IRQ, 0, (sfx_u32) lr11xx_system_irq_mask);
+#endif
+#ifdef LR11XX_RF_API_ERROR_RECOVERY
+    if ((lr11xx_system_irq_mask & LR11XX_SYSTEM_IRQ_ERROR) && (lr1110_ctx.radio_cmd != RADIO_CMD_NONE) && (_lr11xx_recover() == SIGFOX_TRUE)) {
+        // Faulty block has been recalibrated: restart the interrupted operation instead of aborting the sequence.
+        lr11xx_system_irq_mask &= ~LR11XX_SYSTEM_IRQ_ERROR;
+        if (lr1110_ctx.radio_cmd == RADIO_CMD_TX) {
+            lr11xx_status = lr11xx_radio_set_tx(SIGFOX_NULL, lr1110_ctx.tx_timeout_ms);
+        } else {
+            lr11xx_status = lr11xx_radio_set_rx_with_timeout_in_rtc_step(SIGFOX_NULL, 0xFFFFFF);
+        }
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+        }
+    }
+#endif
+    if (lr11xx_system_irq_mask & LR11XX_SYSTEM_IRQ_TX_DONE) {
+#ifdef LR11XX_RF_API_ERROR_RECOVERY
+        lr1110_ctx.radio_cmd = RADIO_CMD_NONE;
+        lr1110_ctx.recovery_info.consecutive_recovery_count = 0;
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+        lr11xx_hw_api_status = LR11XX_HW_API_tx_off();
+        LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+        LR11XX_HW_API_tx_off();
+#endif
+        lr1110_ctx.tx_done_flag = 1;
+#ifdef LR11XX_RF_API_SWEEP
+        if (lr1110_ctx.sweep_running == SIGFOX_TRUE) {
+#ifdef SIGFOX_EP_ERROR_CODES
+            status = _lr11xx_sweep_frame_done();
+            SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+            _lr11xx_sweep_frame_done();
+#endif
+        }
+#endif
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+        if (lr1110_ctx.callbacks.tx_cplt_cb != SIGFOX_NULL) {
+            lr1110_ctx.callbacks.tx_cplt_cb();
+        }
+#endif
+    }
+#if (defined SIGFOX_EP_BIDIRECTIONAL) && (defined LR11XX_RF_API_ASYNC_HAL)
+    if (lr11xx_system_irq_mask & LR11XX_SYSTEM_IRQ_RX_DONE) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_read_dl_frame();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_read_dl_frame();
+#endif
+        // Validation and core library notification are done at the end of the transfer.
+        lr11xx_system_irq_mask &= ~LR11XX_SYSTEM_IRQ_RX_DONE;
+    }
+#endif
+#if (defined SIGFOX_EP_BIDIRECTIONAL) && (defined LR11XX_RF_API_DL_VALIDATION)
+    if (lr11xx_system_irq_mask & LR11XX_SYSTEM_IRQ_RX_DONE) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_validate_dl_frame(&dl_frame_valid);
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_validate_dl_frame(&dl_frame_valid);
+#endif
+        if (dl_frame_valid == SIGFOX_FALSE) {
+            // Reception has been re-armed: the core library is not woken up.
+            lr11xx_system_irq_mask &= ~LR11XX_SYSTEM_IRQ_RX_DONE;
+        }
+    }
+#endif
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    if (lr11xx_system_irq_mask & LR11XX_SYSTEM_IRQ_RX_DONE) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_rx_done();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_rx_done();
+#endif
+    }
+#endif
+    if (lr11xx_system_irq_mask & LR11XX_SYSTEM_IRQ_TIMEOUT) {
+        // TX watchdog elapsed before the end of the frame: the chip is back in standby, the sequence is aborted as on a chip error.
+#ifdef LR11XX_RF_API_ERROR_RECOVERY
+        lr1110_ctx.radio_cmd = RADIO_CMD_NONE;
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+        lr11xx_hw_api_status = LR11XX_HW_API_tx_off();
+        LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+        LR11XX_HW_API_tx_off();
+#endif
+        lr11xx_system_irq_mask |= LR11XX_SYSTEM_IRQ_ERROR;
+    }
+    if (lr11xx_system_irq_mask & LR11XX_SYSTEM_IRQ_ERROR) {
+        lr1110_ctx.error_flag = 1;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+        if (lr1110_ctx.callbacks.error_cb != SIGFOX_NULL) {
+#ifdef SIGFOX_EP_ERROR_CODES
+            lr1110_ctx.callbacks.error_cb((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_IRQ);
+#else
+            lr1110_ctx.callbacks.error_cb();
+#endif
+        }
+#endif
+    }
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+    SIGFOX_RETURN();
+errors:
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ERROR_CODES) && (defined SIGFOX_EP_ASYNCHRONOUS)
+    _lr11xx_stats_count_error(status);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr1110_ctx.callbacks.error_cb(RF_API_ERROR);
+#else
+    lr1110_ctx.callbacks.error_cb();
+#endif
+#endif
+    SIGFOX_RETURN();
+}
+
+#ifdef SIGFOX_EP_LOW_LEVEL_OPEN_CLOSE
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_close(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_CLOSE;
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_close();
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_close();
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+errors:
+#endif
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ERROR_CODES)
+    _lr11xx_stats_count_error(status);
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+/*******************************************************************/
+static RF_API_status_t _lr11xx_cold_wake_up(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+    lr11xx_system_errors_t errors;
+    lr11xx_system_rfswitch_cfg_t rf_switch_setup = {0};
+    LR11XX_HW_API_xosc_cfg_t xosc_cfg;
+#ifdef LR11XX_RF_API_BULK_MODE
+    lr1110_ctx.bulk_radio_valid = SIGFOX_FALSE;
+#endif
+    lr11xx_status = lr11xx_system_reset(SIGFOX_NULL);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RESET);
+    }
+    lr11xx_status = lr11xx_system_wakeup(SIGFOX_NULL);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_WAKEUP);
+    }
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_delayMs(100);
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_delayMs(100);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_detect_chip_variant();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_detect_chip_variant();
+#endif
+    lr11xx_status = lr11xx_system_set_reg_mode(SIGFOX_NULL, LR11XX_SYSTEM_REG_MODE_LDO);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
+#ifdef LR11XX_RF_API_REG_MODE_POLICY
+    lr1110_ctx.reg_mode = LR11XX_SYSTEM_REG_MODE_LDO;
+#endif
+#ifdef LR11XX_RF_API_RC_PROFILES
+    rf_switch_setup = lr1110_ctx.rc_profiles[lr1110_ctx.rc_profile_index].rf_switch_cfg;
+#else
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_get_rf_switch_cfg(&rf_switch_setup);
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_get_rf_switch_cfg(&rf_switch_setup);
+#endif
+#endif
+    _lr11xx_mask_rf_switch_cfg(&rf_switch_setup);
+    lr11xx_status = lr11xx_system_set_dio_as_rf_switch(SIGFOX_NULL, &rf_switch_setup);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
+    lr11xx_status = lr11xx_system_cfg_lfclk(SIGFOX_NULL, LR11XX_SYSTEM_LFCLK_RC, true);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
+    lr11xx_status = lr11xx_system_clear_errors(SIGFOX_NULL);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
+#if (defined LR11XX_RF_API_RC_PROFILES)
+    xosc_cfg = lr1110_ctx.rc_profiles[lr1110_ctx.rc_profile_index].xosc_cfg;
+#elif (defined LR11XX_HW_API_STATIC_CONFIG)
+    xosc_cfg = LR11XX_RF_API_XOSC_CFG;
+#else
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_get_xosc_cfg(&xosc_cfg);
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_get_xosc_cfg(&xosc_cfg);
+#endif
+#endif
+#if (defined LR11XX_RF_API_REG_MODE_POLICY) && !(defined LR11XX_HW_API_STATIC_CONFIG)
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_get_reg_mode_cfg(&(lr1110_ctx.reg_mode_cfg));
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_get_reg_mode_cfg(&(lr1110_ctx.reg_mode_cfg));
+#endif
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_set_tcxo_mode(&xosc_cfg);
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_set_tcxo_mode(&xosc_cfg);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_delayMs(50);
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_delayMs(50);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+    // Set standby on XOSC oscillator to keep the XOSC powered in standby mode and limit warmup time at every Sigfox frame.
+    lr11xx_status = lr11xx_system_set_standby(SIGFOX_NULL, LR11XX_SYSTEM_STANDBY_CFG_XOSC);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_delayMs(300);
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_delayMs(300);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_set_irq_config();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_set_irq_config();
+#endif
+    lr11xx_status = lr11xx_system_get_errors(SIGFOX_NULL, &errors);
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_CHIP_ERRORS, (sfx_u8) lr11xx_status, (sfx_u32) errors);
+#endif
+    if ((lr11xx_status != LR11XX_STATUS_OK) || (errors != 0)) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
+#ifdef LR11XX_RF_API_RC_PROFILES
+    lr1110_ctx.applied_rf_switch_cfg = rf_switch_setup;
+    lr1110_ctx.applied_xosc_cfg = xosc_cfg;
+    // Full calibration has been performed on the default range.
+    lr1110_ctx.applied_image_calib_freq1_mhz = 0;
+    lr1110_ctx.applied_image_calib_freq2_mhz = 0;
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_calibrate_image(&(lr1110_ctx.rc_profiles[lr1110_ctx.rc_profile_index]));
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_calibrate_image(&(lr1110_ctx.rc_profiles[lr1110_ctx.rc_profile_index]));
+#endif
+#endif
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats.cold_wake_up_count++;
+#endif
+errors:
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_wake_up(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+#ifdef LR11XX_RF_API_COEXISTENCE
+    if (lr1110_ctx.coex_owner == LR11XX_RF_API_COEX_OWNER_EXTERNAL) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_BUSY);
+    }
+    lr1110_ctx.sigfox_active = SIGFOX_TRUE;
+#endif
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_WAKE_UP;
+#endif
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_ENTRY, LR11XX_RF_API_FUNCTION_WAKE_UP, 0);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+#ifdef LR11XX_RF_API_BULK_MODE
+    if (lr1110_ctx.bulk_awake == SIGFOX_TRUE) {
+        // Chip has been kept awake and configured since the previous message of the bulk session.
+        lr1110_ctx.bulk_awake = SIGFOX_FALSE;
+        lr1110_ctx.irq_en = 1;
+        goto errors;
+    }
+#endif
+#if (defined LR11XX_RF_API_COEXISTENCE) || (defined LR11XX_RF_API_ERROR_RECOVERY)
+    if (lr1110_ctx.chip_configured == SIGFOX_TRUE) {
+        lr1110_ctx.chip_configured = SIGFOX_FALSE;
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_warm_wake_up();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_warm_wake_up();
+#endif
+    } else {
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_cold_wake_up();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_cold_wake_up();
+#endif
+    }
+#else
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_cold_wake_up();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_cold_wake_up();
+#endif
+#endif
+    lr1110_ctx.chip_configured = SIGFOX_TRUE;
+    lr1110_ctx.irq_en = 1;
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats.wake_up_count++;
+#endif
+#if (defined SIGFOX_EP_ERROR_CODES) || (defined LR11XX_RF_API_COEXISTENCE) || (defined LR11XX_RF_API_BULK_MODE)
+errors:
+#endif
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    LR11XX_RF_API_FLIGHT_RECORD_EXIT(LR11XX_RF_API_FUNCTION_WAKE_UP);
+#endif
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ERROR_CODES)
+    _lr11xx_stats_count_error(status);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_sleep(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+    lr11xx_system_sleep_cfg_t lr11xx_system_sleep_cfg;
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_SLEEP;
+#endif
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_ENTRY, LR11XX_RF_API_FUNCTION_SLEEP, 0);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+#ifdef LR11XX_RF_API_BULK_MODE
+#ifdef LR11XX_RF_API_COEXISTENCE
+    // A pending coexistence request is served as usual, the next message of the session will wake the chip up again.
+    if ((lr1110_ctx.bulk_session == SIGFOX_TRUE) && (lr1110_ctx.chip_configured == SIGFOX_TRUE) && (lr1110_ctx.coex_pending == SIGFOX_FALSE)) {
+#else
+    if ((lr1110_ctx.bulk_session == SIGFOX_TRUE) && (lr1110_ctx.chip_configured == SIGFOX_TRUE)) {
+#endif
+        // Keep the chip in its gap state and the radio configured for the next message of the session.
+        lr1110_ctx.bulk_awake = SIGFOX_TRUE;
+        lr1110_ctx.irq_en = 0;
+        goto errors;
+    }
+    lr1110_ctx.bulk_awake = SIGFOX_FALSE;
+    lr1110_ctx.bulk_radio_valid = SIGFOX_FALSE;
+#endif
+#ifdef LR11XX_RF_API_POWER_POLICY
+    if (lr1110_ctx.gap_mode == LR11XX_RF_API_GAP_MODE_SLEEP) {
+        // Chip has been put to sleep at the end of the last frame: wake it up to apply the final sleep configuration.
+        lr1110_ctx.gap_mode = LR11XX_RF_API_GAP_MODE_STANDBY_XOSC;
+        lr11xx_status = lr11xx_system_wakeup(SIGFOX_NULL);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_WAKEUP);
+        }
+    }
+#endif
+    lr1110_ctx.irq_en = 0;
+#ifdef LR11XX_RF_API_COEXISTENCE
+    lr1110_ctx.sigfox_active = SIGFOX_FALSE;
+    if (lr1110_ctx.coex_pending == SIGFOX_TRUE) {
+        // Leave the chip awake in standby and hand it over to the waiting user.
+        lr1110_ctx.coex_pending = SIGFOX_FALSE;
+        lr1110_ctx.coex_owner = LR11XX_RF_API_COEX_OWNER_EXTERNAL;
+        if (lr1110_ctx.coex_granted_cb != SIGFOX_NULL) {
+            lr1110_ctx.coex_granted_cb();
+        }
+    } else {
+        // Warm start retains the chip configuration so that the next wake-up skips the cold start sequence.
+        lr11xx_system_sleep_cfg.is_warm_start = (lr1110_ctx.chip_configured == SIGFOX_TRUE) ? 1 : 0;
+        lr11xx_system_sleep_cfg.is_rtc_timeout = 0;
+        lr11xx_status = lr11xx_system_set_sleep(SIGFOX_NULL, lr11xx_system_sleep_cfg, 0);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            lr1110_ctx.chip_configured = SIGFOX_FALSE;
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+        }
+    }
+#else
+#ifdef LR11XX_RF_API_ERROR_RECOVERY
+    // Only keep the configuration of a chip recovered from an error, so that the next attempt skips the cold start sequence.
+    if (lr1110_ctx.recovered == SIGFOX_FALSE) {
+        lr1110_ctx.chip_configured = SIGFOX_FALSE;
+    }
+    lr1110_ctx.recovered = SIGFOX_FALSE;
+    lr11xx_system_sleep_cfg.is_warm_start = (lr1110_ctx.chip_configured == SIGFOX_TRUE) ? 1 : 0;
+#else
+    lr1110_ctx.chip_configured = SIGFOX_FALSE;
+    lr11xx_system_sleep_cfg.is_warm_start = 0;
+#endif
+    lr11xx_system_sleep_cfg.is_rtc_timeout = 0;
+    lr11xx_status = lr11xx_system_set_sleep(SIGFOX_NULL, lr11xx_system_sleep_cfg, 0);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        lr1110_ctx.chip_configured = SIGFOX_FALSE;
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
+#endif
+errors:
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    LR11XX_RF_API_FLIGHT_RECORD_EXIT(LR11XX_RF_API_FUNCTION_SLEEP);
+#endif
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ERROR_CODES)
+    _lr11xx_stats_count_error(status);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_init(RF_API_radio_parameters_t *radio_parameters) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+    lr11xx_radio_mod_params_bpsk_t lr11xx_radio_mod_params_bpsk;
+    lr11xx_radio_mod_params_gfsk_t lr11xx_radio_mod_params_gfsk;
+    sfx_s8 tx_power_dbm_eirp = radio_parameters->tx_power_dbm_eirp;
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_INIT;
+#endif
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_ENTRY, LR11XX_RF_API_FUNCTION_INIT, 0);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+#ifdef LR11XX_RF_API_POWER_POLICY
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_exit_gap_mode();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_exit_gap_mode();
+#endif
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_set_rf_frequency(radio_parameters->frequency_hz);
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_set_rf_frequency(radio_parameters->frequency_hz);
+#endif
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_MODULATION, (sfx_u8) (((sfx_u8) radio_parameters->rf_mode << 4) | (sfx_u8) radio_parameters->modulation), radio_parameters->bit_rate_bps);
+#endif
+#ifdef LR11XX_RF_API_ADAPTIVE_TX_POWER
+    if (radio_parameters->rf_mode == RF_API_MODE_TX) {
+        tx_power_dbm_eirp = _lr11xx_get_adaptive_tx_power(radio_parameters->frequency_hz, radio_parameters->tx_power_dbm_eirp);
+    }
+#endif
+#ifdef LR11XX_RF_API_BULK_MODE
+    if ((lr1110_ctx.bulk_session == SIGFOX_TRUE) && (_lr11xx_bulk_radio_parameters_equal(radio_parameters, tx_power_dbm_eirp) == SIGFOX_TRUE)) {
+        // Static settings have already been applied during the session: only the frequency changes.
+        goto errors;
+    }
+    lr1110_ctx.bulk_radio_valid = SIGFOX_FALSE;
+#endif
+#ifdef LR11XX_RF_API_REG_MODE_POLICY
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_apply_reg_mode_policy(radio_parameters->rf_mode, radio_parameters->modulation);
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_apply_reg_mode_policy(radio_parameters->rf_mode, radio_parameters->modulation);
+#endif
+#endif
+    switch (radio_parameters->modulation) {
+    case RF_API_MODULATION_DBPSK:
+        lr11xx_status = lr11xx_radio_set_pkt_type(SIGFOX_NULL, LR11XX_RADIO_PKT_TYPE_BPSK);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+        }
+        lr11xx_radio_mod_params_bpsk.br_in_bps = radio_parameters->bit_rate_bps;
+        lr11xx_radio_mod_params_bpsk.pulse_shape = LR11XX_RADIO_DBPSK_PULSE_SHAPE;
+        lr11xx_status = lr11xx_radio_set_bpsk_mod_params(SIGFOX_NULL, &lr11xx_radio_mod_params_bpsk);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+        }
+        break;
+    case RF_API_MODULATION_GFSK:
+        lr11xx_status = lr11xx_radio_set_pkt_type(SIGFOX_NULL, LR11XX_RADIO_PKT_TYPE_GFSK);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+        }
+        lr11xx_radio_mod_params_gfsk.br_in_bps = radio_parameters->bit_rate_bps;
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+        lr11xx_radio_mod_params_gfsk.fdev_in_hz = radio_parameters->deviation_hz;
+#endif
+        lr11xx_radio_mod_params_gfsk.pulse_shape = LR11XX_RADIO_GFSK_PULSE_SHAPE_BT_1;
+        lr11xx_radio_mod_params_gfsk.bw_dsb_param = LR11XX_RADIO_GFSK_BW_4800;
+        lr11xx_status = lr11xx_radio_set_gfsk_mod_params(SIGFOX_NULL, &lr11xx_radio_mod_params_gfsk);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+        }
+        break;
+    case RF_API_MODULATION_NONE:
+        lr11xx_status = lr11xx_radio_set_pkt_type(SIGFOX_NULL, LR11XX_RADIO_PKT_TYPE_RTTOF);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+        }
+        break;
+    default:
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_MODULATION);
+    }
+
+    if (radio_parameters->rf_mode == RF_API_MODE_TX) {
+        lr1110_ctx.backup_bit_rate_bps_patch = radio_parameters->bit_rate_bps;
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_set_tx_power(radio_parameters->frequency_hz, tx_power_dbm_eirp);
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_set_tx_power(radio_parameters->frequency_hz, tx_power_dbm_eirp);
+#endif
+    }
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    if (radio_parameters->rf_mode == RF_API_MODE_RX) {
+        lr11xx_status = lr11xx_radio_cfg_rx_boosted(SIGFOX_NULL, 0x01);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+        }
+    }
+#endif
+#ifdef LR11XX_RF_API_BULK_MODE
+    lr1110_ctx.bulk_radio_parameters = (*radio_parameters);
+    lr1110_ctx.bulk_radio_parameters.tx_power_dbm_eirp = tx_power_dbm_eirp;
+    lr1110_ctx.bulk_radio_valid = lr1110_ctx.bulk_session;
+#endif
+errors:
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    LR11XX_RF_API_FLIGHT_RECORD_EXIT(LR11XX_RF_API_FUNCTION_INIT);
+#endif
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ERROR_CODES)
+    _lr11xx_stats_count_error(status);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_de_init(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+#ifndef LR11XX_RF_API_POWER_POLICY
+    lr11xx_status_t lr11xx_status;
+#endif
+#ifdef LR11XX_RF_API_ADAPTIVE_TX_POWER
+    LR11XX_RF_API_rssi_history_t *rssi_history = SIGFOX_NULL;
+#endif
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_DE_INIT;
+#endif
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_ENTRY, LR11XX_RF_API_FUNCTION_DE_INIT, 0);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+#ifdef LR11XX_RF_API_POWER_POLICY
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_enter_gap_mode();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_enter_gap_mode();
+#endif
+#else
+    lr11xx_status = lr11xx_system_set_standby(SIGFOX_NULL, LR11XX_SYSTEM_STANDBY_CFG_XOSC);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
+#endif
+#ifdef LR11XX_RF_API_ADAPTIVE_TX_POWER
+    if (lr1110_ctx.dl_expected == SIGFOX_TRUE) {
+        // No downlink has been received: restore the full power in this band.
+        lr1110_ctx.dl_expected = SIGFOX_FALSE;
+        rssi_history = _lr11xx_get_rssi_history(lr1110_ctx.ul_frequency_hz, SIGFOX_FALSE);
+        if (rssi_history != SIGFOX_NULL) {
+            rssi_history->rssi_count = 0;
+            rssi_history->power_reduction_db = 0;
+        }
+    }
+#endif
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_rx_off();
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_rx_off();
+#endif
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_tx_off();
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_tx_off();
+#endif
+#if (defined SIGFOX_EP_ERROR_CODES) || !(defined LR11XX_RF_API_POWER_POLICY)
+errors:
+#endif
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    LR11XX_RF_API_FLIGHT_RECORD_EXIT(LR11XX_RF_API_FUNCTION_DE_INIT);
+#endif
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ERROR_CODES)
+    _lr11xx_stats_count_error(status);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_send(RF_API_tx_data_t *tx_data) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+#endif
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    lr1110_ctx.callbacks.tx_cplt_cb = tx_data->cplt_cb;
+#endif
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_SEND;
+#endif
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_ENTRY, LR11XX_RF_API_FUNCTION_SEND, 0);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+    lr1110_ctx.tx_done_flag = 0;
+    lr1110_ctx.error_flag = 0;
+#ifdef LR11XX_RF_API_ASYNC_HAL
+    // The transmission is started by the process function once the frame has been written.
+    lr1110_ctx.hal_operation = HAL_OPERATION_WRITE_TX_BUFFER;
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_write_dbpsk_frame(tx_data->bitstream, tx_data->bitstream_size_bytes);
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_write_dbpsk_frame(tx_data->bitstream, tx_data->bitstream_size_bytes);
+#endif
+#ifndef LR11XX_RF_API_ASYNC_HAL
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_start_tx();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_start_tx();
+#endif
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+    while (lr1110_ctx.tx_done_flag != 1) {
+        if (lr1110_ctx.irq_flag != 1) {
+#ifdef SIGFOX_EP_ERROR_CODES
+            lr11xx_hw_api_status = LR11XX_HW_API_wait_irq();
+            LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+            LR11XX_HW_API_wait_irq();
+#endif
+        }
+        if (lr1110_ctx.irq_flag == 1) {
+#ifdef SIGFOX_EP_ERROR_CODES
+            status = LR11XX_RF_API_process();
+            SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+            LR11XX_RF_API_process();
+#endif
+            if (lr1110_ctx.error_flag == 1) {
+                SIGFOX_EXIT_ERROR((RF_API_status_t) RF_API_ERROR);
+            }
+        }
+    }
+#endif
+#if (defined SIGFOX_EP_ERROR_CODES) || !(defined SIGFOX_EP_ASYNCHRONOUS)
+errors:
+#endif
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    LR11XX_RF_API_FLIGHT_RECORD_EXIT(LR11XX_RF_API_FUNCTION_SEND);
+#endif
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ERROR_CODES)
+    _lr11xx_stats_count_error(status);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+    SIGFOX_RETURN();
+}
+
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_receive(RF_API_rx_data_t *rx_data) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+    MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
+#endif
+#endif
+    lr11xx_status_t lr11xx_status;
+    lr11xx_radio_pkt_params_gfsk_t lr11xx_radio_pkt_params_gfsk;
     sfx_u8 const sync_world[8] = SIGFOX_DL_FT;
 #ifdef SIGFOX_EP_ASYNCHRONOUS
-    lr1110_ctx.callbacks.rx_data_received_cb = rx_data->data_received_cb;
+    lr1110_ctx.callbacks.rx_data_received_cb = rx_data->data_received_cb;
+#else
+    sfx_bool timer_has_elapsed;
+#endif
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_RECEIVE;
+#endif
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_ENTRY, LR11XX_RF_API_FUNCTION_RECEIVE, 0);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+    lr1110_ctx.rx_done_flag = 0;
+    lr1110_ctx.error_flag = 0;
+    lr11xx_radio_pkt_params_gfsk.address_filtering = LR11XX_RADIO_GFSK_ADDRESS_FILTERING_DISABLE;
+    lr11xx_radio_pkt_params_gfsk.crc_type = LR11XX_RADIO_GFSK_CRC_OFF;
+    lr11xx_radio_pkt_params_gfsk.dc_free = LR11XX_RADIO_GFSK_DC_FREE_OFF;
+    lr11xx_radio_pkt_params_gfsk.header_type = LR11XX_RADIO_GFSK_PKT_FIX_LEN;
+    lr11xx_radio_pkt_params_gfsk.pld_len_in_bytes = SIGFOX_DL_PHY_CONTENT_SIZE_BYTES;
+    lr11xx_radio_pkt_params_gfsk.preamble_detector = LR11XX_RADIO_GFSK_PREAMBLE_DETECTOR_MIN_16BITS;
+    lr11xx_radio_pkt_params_gfsk.preamble_len_in_bits = LR11XX_RF_API_DL_PREAMBLE_SIZE_BITS;
+    lr11xx_radio_pkt_params_gfsk.sync_word_len_in_bits = SIGFOX_DL_FT_SIZE_BYTES * 8;
+    lr11xx_status = lr11xx_radio_set_gfsk_pkt_params(SIGFOX_NULL, &lr11xx_radio_pkt_params_gfsk);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+    }
+    lr11xx_status = lr11xx_radio_set_gfsk_sync_word(SIGFOX_NULL, sync_world);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+    }
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_rx_on();
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_rx_on();
+#endif
+#ifdef LR11XX_RF_API_ERROR_RECOVERY
+    lr1110_ctx.radio_cmd = RADIO_CMD_RX;
+#endif
+#ifdef LR11XX_RF_API_ADAPTIVE_TX_POWER
+    lr1110_ctx.dl_expected = SIGFOX_TRUE;
+#endif
+    lr11xx_status = lr11xx_radio_set_rx_with_timeout_in_rtc_step(SIGFOX_NULL, 0xFFFFFF);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+    }
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+    while (1) {
+        if (lr1110_ctx.irq_flag != 1) {
+#ifdef SIGFOX_EP_ERROR_CODES
+            lr11xx_hw_api_status = LR11XX_HW_API_wait_irq();
+            LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+            LR11XX_HW_API_wait_irq();
+#endif
+        }
+        if (lr1110_ctx.irq_flag == 1) {
+#ifdef SIGFOX_EP_ERROR_CODES
+            status = LR11XX_RF_API_process();
+            SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+            LR11XX_RF_API_process();
+#endif
+            if (lr1110_ctx.error_flag == 1) {
+                SIGFOX_EXIT_ERROR((RF_API_status_t) RF_API_ERROR);
+            }
+            if (lr1110_ctx.rx_done_flag == 1) {
+                rx_data->data_received = SIGFOX_TRUE;
+                break;
+            }
+        }
+#ifdef SIGFOX_EP_ERROR_CODES
+        mcu_api_status = MCU_API_timer_status(MCU_API_TIMER_INSTANCE_T_RX, &timer_has_elapsed);
+        MCU_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_MCU_API);
+#else
+        MCU_API_timer_status(MCU_API_TIMER_INSTANCE_T_RX, &timer_has_elapsed);
+#endif
+        if (timer_has_elapsed == SIGFOX_TRUE) {
+            break;
+        }
+    }
+#endif
+errors:
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    LR11XX_RF_API_FLIGHT_RECORD_EXIT(LR11XX_RF_API_FUNCTION_RECEIVE);
+#endif
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ERROR_CODES)
+    _lr11xx_stats_count_error(status);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_get_dl_phy_content_and_rssi(sfx_u8 *dl_phy_content, sfx_u8 dl_phy_content_size, sfx_s16 *dl_rssi_dbm) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+    lr11xx_radio_pkt_status_gfsk_t lr11xx_radio_pkt_status_gfsk;
+#ifdef LR11XX_RF_API_ASYNC_HAL
+    sfx_u8 idx = 0;
+#else
+    lr11xx_radio_rx_buffer_status_t lr11xx_radio_rx_buffer_status;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((dl_phy_content == SIGFOX_NULL) || (dl_rssi_dbm == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_NULL_PARAMETER);
+    }
+    if (dl_phy_content_size > SIGFOX_DL_PHY_CONTENT_SIZE_BYTES) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_BUFFER_SIZE);
+    }
+#endif
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_GET_DL_PHY_CONTENT_AND_RSSI;
+#endif
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_ENTRY, LR11XX_RF_API_FUNCTION_GET_DL_PHY_CONTENT_AND_RSSI, 0);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+    if (lr1110_ctx.rx_done_flag != SIGFOX_TRUE) {
+#ifdef LR11XX_RF_API_STATISTICS
+        lr1110_ctx.stats.state_error_count++;
+#endif
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_STATE);
+    }
+    lr11xx_status = lr11xx_radio_get_gfsk_pkt_status(SIGFOX_NULL, &lr11xx_radio_pkt_status_gfsk);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+    }
+    if (lr11xx_radio_pkt_status_gfsk.is_received == 1) {
+        *dl_rssi_dbm = (sfx_s16) lr11xx_radio_pkt_status_gfsk.rssi_avg_in_dbm;
+#ifdef LR11XX_RF_API_ADAPTIVE_TX_POWER
+        lr1110_ctx.dl_expected = SIGFOX_FALSE;
+        _lr11xx_add_rssi_sample(*dl_rssi_dbm);
+#endif
+#ifdef LR11XX_RF_API_ASYNC_HAL
+        // Frame has already been read by the asynchronous transfer.
+        for (idx = 0; idx < dl_phy_content_size; idx++) {
+            dl_phy_content[idx] = lr1110_ctx.dl_phy_content[idx];
+        }
+#else
+        lr11xx_status = lr11xx_radio_get_rx_buffer_status(SIGFOX_NULL, &lr11xx_radio_rx_buffer_status);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+        }
+        lr11xx_status = lr11xx_regmem_read_buffer8(SIGFOX_NULL, dl_phy_content, lr11xx_radio_rx_buffer_status.buffer_start_pointer, dl_phy_content_size);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_REGMEM_REG);
+        }
+#endif
+        lr11xx_status = lr11xx_regmem_clear_rxbuffer(SIGFOX_NULL);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_REGMEM_REG);
+        }
+#ifdef LR11XX_RF_API_STATISTICS
+        lr1110_ctx.stats.rx_frame_count++;
+#endif
+    }
+errors:
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    LR11XX_RF_API_FLIGHT_RECORD_EXIT(LR11XX_RF_API_FUNCTION_GET_DL_PHY_CONTENT_AND_RSSI);
+#endif
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ERROR_CODES)
+    _lr11xx_stats_count_error(status);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_LBT)
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_carrier_sense(RF_API_carrier_sense_parameters_t *carrier_sense_params) {
+    /* To be implemented by the device manufacturer */
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+    SIGFOX_UNUSED(carrier_sense_params);
+    SIGFOX_RETURN();
+}
+#endif
+
+#if (defined SIGFOX_EP_TIMER_REQUIRED) && (defined SIGFOX_EP_LATENCY_COMPENSATION)
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_get_latency(RF_API_latency_t latency_type, sfx_u32 *latency_ms) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#ifndef LR11XX_HW_API_STATIC_CONFIG
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+#endif
+#ifndef LR11XX_HW_API_STATIC_CONFIG
+    sfx_u32 latency_tmp = 0;
+#endif
+    switch (latency_type) {
+    case RF_API_LATENCY_WAKE_UP:
+#ifdef LR11XX_HW_API_STATIC_CONFIG
+        *latency_ms = 532 + LR11XX_BOARD_LATENCY_RESET_MS + LR11XX_BOARD_LATENCY_WAKEUP_MS;
+#else
+        *latency_ms = 532;
+#ifdef SIGFOX_EP_ERROR_CODES
+        lr11xx_hw_api_status = LR11XX_HW_API_get_latency(LR11XX_HW_API_LATENCY_RESET, &latency_tmp);
+        LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+        LR11XX_HW_API_get_latency(LR11XX_HW_API_LATENCY_RESET, &latency_tmp);
+#endif
+        (*latency_ms) += latency_tmp;
+#ifdef SIGFOX_EP_ERROR_CODES
+        lr11xx_hw_api_status = LR11XX_HW_API_get_latency(LR11XX_HW_API_LATENCY_WAKEUP, &latency_tmp);
+        LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+        LR11XX_HW_API_get_latency(LR11XX_HW_API_LATENCY_RESET, &latency_tmp);
+#endif
+        (*latency_ms) += latency_tmp;
+#endif
+        break;
+    case RF_API_LATENCY_INIT_TX:
+        *latency_ms = T_RADIO_DELAY_ON;
+        break;
+    case RF_API_LATENCY_SEND_START:
+        *latency_ms = (T_RADIO_BIT_LATENCY_ON * 1000) / lr1110_ctx.backup_bit_rate_bps_patch;
+        break;
+    case RF_API_LATENCY_SEND_STOP:
+        *latency_ms = (T_RADIO_BIT_LATENCY_OFF * 1000) / lr1110_ctx.backup_bit_rate_bps_patch;
+        break;
+    case RF_API_LATENCY_DE_INIT_TX:
+        *latency_ms = 0;
+        break;
+    case RF_API_LATENCY_SLEEP:
+        *latency_ms = 0;
+        break;
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    case RF_API_LATENCY_INIT_RX:
+        *latency_ms = 0;
+        break;
+    case RF_API_LATENCY_RECEIVE_START:
+        *latency_ms = 0;
+        break;
+    case RF_API_LATENCY_RECEIVE_STOP:
+        *latency_ms = 5;
+        break;
+    case RF_API_LATENCY_DE_INIT_RX:
+        *latency_ms = 0;
+        break;
+#endif
+    default:
+        *latency_ms = 0;
+    }
+#if (defined SIGFOX_EP_ERROR_CODES) && !(defined LR11XX_HW_API_STATIC_CONFIG)
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_get_ul_airtime(sfx_u8 bitstream_size_bytes, sfx_u16 bit_rate_bps, sfx_u32 *airtime_us) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (airtime_us == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_NULL_PARAMETER);
+    }
+    if (bitstream_size_bytes > SIGFOX_UL_BITSTREAM_SIZE_BYTES) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_BUFFER_SIZE);
+    }
+#endif
+    if (bit_rate_bps == 0) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_MODULATION);
+    }
+    (*airtime_us) = _lr11xx_compute_ul_airtime_us(bitstream_size_bytes, bit_rate_bps);
+errors:
+    SIGFOX_RETURN();
+}
+
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_get_dl_airtime(sfx_u16 bit_rate_bps, sfx_u32 *airtime_us) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (airtime_us == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    if (bit_rate_bps == 0) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_MODULATION);
+    }
+    (*airtime_us) = _lr11xx_compute_dl_airtime_us(bit_rate_bps);
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+/*******************************************************************/
+LR11XX_RF_API_chip_variant_t LR11XX_RF_API_get_chip_variant(void) {
+    return lr1110_ctx.chip_variant;
+}
+
+#ifdef SIGFOX_EP_CERTIFICATION
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_start_continuous_wave(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_START_CONTINUOUS_WAVE;
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_tx_on();
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_tx_on();
+#endif
+    // Start radio.
+    lr11xx_status = lr11xx_radio_set_tx_cw(SIGFOX_NULL);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+    }
+errors:
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ERROR_CODES)
+    _lr11xx_stats_count_error(status);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_SWEEP
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_start_sweep(LR11XX_RF_API_sweep_config_t *sweep_config) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+#endif
+    lr11xx_status_t lr11xx_status;
+    lr11xx_radio_mod_params_bpsk_t lr11xx_radio_mod_params_bpsk;
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+    sfx_u32 remaining_delay_ms = 0;
+    sfx_u16 delay_ms = 0;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((sweep_config == SIGFOX_NULL) || (sweep_config->points == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    if ((sweep_config->number_of_points == 0) || (sweep_config->mode >= LR11XX_RF_API_SWEEP_MODE_LAST) || ((sweep_config->mode == LR11XX_RF_API_SWEEP_MODE_DBPSK) && (sweep_config->bit_rate_bps == 0))) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_SWEEP);
+    }
+    if ((lr1110_ctx.irq_en != 1) || (lr1110_ctx.sweep_running == SIGFOX_TRUE)) {
+#ifdef LR11XX_RF_API_STATISTICS
+        lr1110_ctx.stats.state_error_count++;
+#endif
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_STATE);
+    }
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_OTHER;
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+#ifdef LR11XX_RF_API_BULK_MODE
+    lr1110_ctx.bulk_radio_valid = SIGFOX_FALSE;
+#endif
+#ifdef LR11XX_RF_API_REG_MODE_POLICY
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_apply_reg_mode_policy(RF_API_MODE_TX, RF_API_MODULATION_NONE);
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_apply_reg_mode_policy(RF_API_MODE_TX, RF_API_MODULATION_NONE);
+#endif
+#endif
+    // Modulation is configured once for the whole sweep.
+    if (sweep_config->mode == LR11XX_RF_API_SWEEP_MODE_DBPSK) {
+        lr11xx_status = lr11xx_radio_set_pkt_type(SIGFOX_NULL, LR11XX_RADIO_PKT_TYPE_BPSK);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+        }
+        lr11xx_radio_mod_params_bpsk.br_in_bps = sweep_config->bit_rate_bps;
+        lr11xx_radio_mod_params_bpsk.pulse_shape = LR11XX_RADIO_DBPSK_PULSE_SHAPE;
+        lr11xx_status = lr11xx_radio_set_bpsk_mod_params(SIGFOX_NULL, &lr11xx_radio_mod_params_bpsk);
+        if (lr11xx_status != LR11XX_STATUS_OK) {
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+        }
+        lr1110_ctx.backup_bit_rate_bps_patch = sweep_config->bit_rate_bps;
+    }
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    // Sweep frames must not be reported to the core library.
+    lr1110_ctx.callbacks.tx_cplt_cb = SIGFOX_NULL;
+    lr1110_ctx.sweep_timer_flag = 0;
+#endif
+    lr1110_ctx.error_flag = 0;
+    lr1110_ctx.sweep_config = (*sweep_config);
+    lr1110_ctx.sweep_point_index = 0;
+    lr1110_ctx.sweep_running = SIGFOX_TRUE;
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_sweep_start_point();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_sweep_start_point();
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+    while (lr1110_ctx.sweep_running == SIGFOX_TRUE) {
+        if ((lr1110_ctx.sweep_config.mode == LR11XX_RF_API_SWEEP_MODE_DBPSK) && (lr1110_ctx.irq_flag != 1)) {
+#ifdef SIGFOX_EP_ERROR_CODES
+            lr11xx_hw_api_status = LR11XX_HW_API_wait_irq();
+            LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+            LR11XX_HW_API_wait_irq();
+#endif
+        }
+        if (lr1110_ctx.sweep_config.mode == LR11XX_RF_API_SWEEP_MODE_CW) {
+            remaining_delay_ms = lr1110_ctx.sweep_config.points[lr1110_ctx.sweep_point_index].dwell_ms;
+            while (remaining_delay_ms > 0) {
+                delay_ms = (sfx_u16) ((remaining_delay_ms > LR11XX_RF_API_SWEEP_DELAY_MAX_MS) ? LR11XX_RF_API_SWEEP_DELAY_MAX_MS : remaining_delay_ms);
+#ifdef SIGFOX_EP_ERROR_CODES
+                lr11xx_hw_api_status = LR11XX_HW_API_delayMs(delay_ms);
+                LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+                LR11XX_HW_API_delayMs(delay_ms);
+#endif
+                remaining_delay_ms -= delay_ms;
+            }
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+            status = _lr11xx_bus_acquire();
+            SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+            _lr11xx_bus_acquire();
+#endif
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+            status = _lr11xx_sweep_next_point();
+            SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+            _lr11xx_sweep_next_point();
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+            _lr11xx_bus_release();
+#endif
+        } else if (lr1110_ctx.irq_flag == 1) {
+#ifdef SIGFOX_EP_ERROR_CODES
+            status = LR11XX_RF_API_process();
+            SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+            LR11XX_RF_API_process();
+#endif
+            if (lr1110_ctx.error_flag == 1) {
+                SIGFOX_EXIT_ERROR((RF_API_status_t) RF_API_ERROR);
+            }
+        }
+    }
+#endif
+errors:
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ERROR_CODES)
+    _lr11xx_stats_count_error(status);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_SWEEP
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_stop_sweep(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_OTHER;
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+    lr1110_ctx.sweep_running = SIGFOX_FALSE;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    lr1110_ctx.sweep_timer_flag = 0;
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_timer_stop();
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
 #else
-    sfx_bool timer_has_elapsed;
+    LR11XX_HW_API_timer_stop();
 #endif
-    lr1110_ctx.rx_done_flag = 0;
-    lr1110_ctx.error_flag = 0;
-    lr11xx_radio_pkt_params_gfsk.address_filtering = LR11XX_RADIO_GFSK_ADDRESS_FILTERING_DISABLE;
-    lr11xx_radio_pkt_params_gfsk.crc_type = LR11XX_RADIO_GFSK_CRC_OFF;
-    lr11xx_radio_pkt_params_gfsk.dc_free = LR11XX_RADIO_GFSK_DC_FREE_OFF;
-    lr11xx_radio_pkt_params_gfsk.header_type = LR11XX_RADIO_GFSK_PKT_FIX_LEN;
-    lr11xx_radio_pkt_params_gfsk.pld_len_in_bytes = SIGFOX_DL_PHY_CONTENT_SIZE_BYTES;
-    lr11xx_radio_pkt_params_gfsk.preamble_detector = LR11XX_RADIO_GFSK_PREAMBLE_DETECTOR_MIN_16BITS;
-    lr11xx_radio_pkt_params_gfsk.preamble_len_in_bits = 16;
-    lr11xx_radio_pkt_params_gfsk.sync_word_len_in_bits = SIGFOX_DL_FT_SIZE_BYTES * 8;
-    lr11xx_status = lr11xx_radio_set_gfsk_pkt_params(SIGFOX_NULL, &lr11xx_radio_pkt_params_gfsk);
+#endif
+    lr11xx_status = lr11xx_system_set_standby(SIGFOX_NULL, LR11XX_SYSTEM_STANDBY_CFG_XOSC);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_tx_off();
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_tx_off();
+#endif
+errors:
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ERROR_CODES)
+    _lr11xx_stats_count_error(status);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_SPECTRUM_SCAN
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_start_spectrum_scan(LR11XX_RF_API_scan_config_t *scan_config) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+    lr11xx_radio_mod_params_gfsk_t lr11xx_radio_mod_params_gfsk;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((scan_config == SIGFOX_NULL) || (scan_config->results == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    if ((scan_config->number_of_channels == 0) || (scan_config->sample_period_ms == 0)) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_SPECTRUM_SCAN);
+    }
+    if ((lr1110_ctx.irq_en != 1) || (lr1110_ctx.scan_running == SIGFOX_TRUE)) {
+#ifdef LR11XX_RF_API_STATISTICS
+        lr1110_ctx.stats.state_error_count++;
+#endif
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_STATE);
+    }
+#ifdef LR11XX_RF_API_SWEEP
+    if (lr1110_ctx.sweep_running == SIGFOX_TRUE) {
+#ifdef LR11XX_RF_API_STATISTICS
+        lr1110_ctx.stats.state_error_count++;
+#endif
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_STATE);
+    }
+#endif
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_OTHER;
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+#ifdef LR11XX_RF_API_BULK_MODE
+    lr1110_ctx.bulk_radio_valid = SIGFOX_FALSE;
+#endif
+#ifdef LR11XX_RF_API_REG_MODE_POLICY
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_apply_reg_mode_policy(RF_API_MODE_RX, RF_API_MODULATION_GFSK);
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_apply_reg_mode_policy(RF_API_MODE_RX, RF_API_MODULATION_GFSK);
+#endif
+#endif
+    // Modulation is configured once for the whole scan.
+    lr11xx_status = lr11xx_radio_set_pkt_type(SIGFOX_NULL, LR11XX_RADIO_PKT_TYPE_GFSK);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+    }
+    lr11xx_radio_mod_params_gfsk.br_in_bps = LR11XX_RF_API_SCAN_BIT_RATE_BPS;
+    lr11xx_radio_mod_params_gfsk.fdev_in_hz = LR11XX_RF_API_SCAN_DEVIATION_HZ;
+    lr11xx_radio_mod_params_gfsk.pulse_shape = LR11XX_RADIO_GFSK_PULSE_SHAPE_BT_1;
+    lr11xx_radio_mod_params_gfsk.bw_dsb_param = LR11XX_RADIO_GFSK_BW_4800;
+    lr11xx_status = lr11xx_radio_set_gfsk_mod_params(SIGFOX_NULL, &lr11xx_radio_mod_params_gfsk);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+    }
+    lr11xx_status = lr11xx_radio_cfg_rx_boosted(SIGFOX_NULL, 0x01);
     if (lr11xx_status != LR11XX_STATUS_OK) {
         SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
     }
-    lr11xx_status = lr11xx_radio_set_gfsk_sync_word(SIGFOX_NULL, sync_world);
-    if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_rx_on();
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_rx_on();
+#endif
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    // Frames received during the scan must not be reported to the core library.
+    lr1110_ctx.callbacks.rx_data_received_cb = SIGFOX_NULL;
+    lr1110_ctx.scan_timer_flag = 0;
+#endif
+    lr1110_ctx.error_flag = 0;
+    lr1110_ctx.scan_config = (*scan_config);
+    lr1110_ctx.scan_channel_index = 0;
+    lr1110_ctx.scan_samples_per_channel = (scan_config->dwell_ms / scan_config->sample_period_ms);
+    if (lr1110_ctx.scan_samples_per_channel == 0) {
+        lr1110_ctx.scan_samples_per_channel = 1;
+    }
+    lr1110_ctx.scan_running = SIGFOX_TRUE;
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_scan_start_channel();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_scan_start_channel();
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+    while (lr1110_ctx.scan_running == SIGFOX_TRUE) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        lr11xx_hw_api_status = LR11XX_HW_API_delayMs(lr1110_ctx.scan_config.sample_period_ms);
+        LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+        LR11XX_HW_API_delayMs(lr1110_ctx.scan_config.sample_period_ms);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_bus_acquire();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_bus_acquire();
+#endif
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_scan_sample();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_scan_sample();
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+        _lr11xx_bus_release();
+#endif
+    }
+#endif
+errors:
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ERROR_CODES)
+    _lr11xx_stats_count_error(status);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_SPECTRUM_SCAN
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_stop_spectrum_scan(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+    lr11xx_status_t lr11xx_status;
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_OTHER;
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+    lr1110_ctx.scan_running = SIGFOX_FALSE;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    lr1110_ctx.scan_timer_flag = 0;
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_timer_stop();
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_timer_stop();
+#endif
+#endif
+    lr11xx_status = lr11xx_system_set_standby(SIGFOX_NULL, LR11XX_SYSTEM_STANDBY_CFG_XOSC);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_rx_off();
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_rx_off();
+#endif
+errors:
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ERROR_CODES)
+    _lr11xx_stats_count_error(status);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_COEXISTENCE
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_coex_acquire(LR11XX_RF_API_coex_granted_cb_t granted_cb) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+    if ((lr1110_ctx.coex_owner == LR11XX_RF_API_COEX_OWNER_EXTERNAL) || (lr1110_ctx.coex_pending == SIGFOX_TRUE)) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_BUSY);
+    }
+    lr1110_ctx.coex_granted_cb = granted_cb;
+    if (lr1110_ctx.sigfox_active == SIGFOX_TRUE) {
+        // Granted at the end of the current Sigfox sequence.
+        lr1110_ctx.coex_pending = SIGFOX_TRUE;
+    } else {
+        lr1110_ctx.coex_owner = LR11XX_RF_API_COEX_OWNER_EXTERNAL;
+        if (granted_cb != SIGFOX_NULL) {
+            granted_cb();
+        }
+    }
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_COEXISTENCE
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_coex_release(sfx_bool chip_config_lost) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+    if (lr1110_ctx.coex_owner != LR11XX_RF_API_COEX_OWNER_EXTERNAL) {
+#ifdef LR11XX_RF_API_STATISTICS
+        lr1110_ctx.stats.state_error_count++;
+#endif
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_STATE);
+    }
+    lr1110_ctx.coex_owner = LR11XX_RF_API_COEX_OWNER_NONE;
+    lr1110_ctx.coex_granted_cb = SIGFOX_NULL;
+    if (chip_config_lost == SIGFOX_TRUE) {
+        lr1110_ctx.chip_configured = SIGFOX_FALSE;
+    }
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_COEXISTENCE
+/*******************************************************************/
+LR11XX_RF_API_coex_owner_t LR11XX_RF_API_coex_get_owner(void) {
+    if (lr1110_ctx.coex_owner == LR11XX_RF_API_COEX_OWNER_EXTERNAL) {
+        return LR11XX_RF_API_COEX_OWNER_EXTERNAL;
+    }
+    return (lr1110_ctx.sigfox_active == SIGFOX_TRUE) ? LR11XX_RF_API_COEX_OWNER_SIGFOX : LR11XX_RF_API_COEX_OWNER_NONE;
+}
+#endif
+
+#ifdef LR11XX_RF_API_RC_PROFILES
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_load_rc_profile(sfx_u8 profile_index, const SIGFOX_rc_t *rc) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (rc == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    if (profile_index >= LR11XX_RF_API_RC_PROFILES) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_RC_PROFILE);
+    }
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_OTHER;
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_load_rc_profile(profile_index, rc);
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_load_rc_profile(profile_index, rc);
+#endif
+    // Apply the new settings right away if the reloaded profile is the active one and the radio is running.
+    if ((profile_index == lr1110_ctx.rc_profile_index) && (lr1110_ctx.irq_en == 1)) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _lr11xx_apply_rc_profile();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+        _lr11xx_apply_rc_profile();
+#endif
+    }
+errors:
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ERROR_CODES)
+    _lr11xx_stats_count_error(status);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_RC_PROFILES
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_switch_rc_profile(sfx_u8 profile_index) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
+    if ((profile_index >= LR11XX_RF_API_RC_PROFILES) || (lr1110_ctx.rc_profiles[profile_index].rc == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_RC_PROFILE);
+    }
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_OTHER;
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+    if (profile_index != lr1110_ctx.rc_profile_index) {
+        lr1110_ctx.rc_profile_index = profile_index;
+#ifdef SIGFOX_EP_ERROR_CODES
+        lr11xx_hw_api_status = LR11XX_HW_API_set_rc(lr1110_ctx.rc_profiles[profile_index].rc);
+        LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+        LR11XX_HW_API_set_rc(lr1110_ctx.rc_profiles[profile_index].rc);
+#endif
+        // If the radio is sleeping, the profile is applied at next wake-up.
+        if (lr1110_ctx.irq_en == 1) {
+#ifdef SIGFOX_EP_ERROR_CODES
+            status = _lr11xx_apply_rc_profile();
+            SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+            _lr11xx_apply_rc_profile();
+#endif
+        }
+    }
+errors:
+#if (defined LR11XX_RF_API_STATISTICS) && (defined SIGFOX_EP_ERROR_CODES)
+    _lr11xx_stats_count_error(status);
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_ERROR_RECOVERY
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_get_recovery_info(LR11XX_RF_API_recovery_info_t *recovery_info) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (recovery_info == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    (*recovery_info) = lr1110_ctx.recovery_info;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_SHARED_BUS
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_get_bus_stats(LR11XX_RF_API_bus_stats_t *bus_stats, sfx_bool reset) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (bus_stats == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    (*bus_stats) = lr1110_ctx.bus_stats;
+    if (reset == SIGFOX_TRUE) {
+        lr1110_ctx.bus_stats.acquire_count = 0;
+        lr1110_ctx.bus_stats.hold_time_last_us = 0;
+        lr1110_ctx.bus_stats.hold_time_max_us = 0;
+        lr1110_ctx.bus_stats.hold_time_total_us = 0;
+    }
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_POWER_POLICY
+/*******************************************************************/
+void LR11XX_RF_API_set_gap_hint(sfx_u32 gap_ms) {
+    lr1110_ctx.gap_hint_ms = gap_ms;
+}
+#endif
+
+#ifdef LR11XX_RF_API_POWER_POLICY
+/*******************************************************************/
+LR11XX_RF_API_gap_mode_t LR11XX_RF_API_get_gap_mode(void) {
+    return lr1110_ctx.gap_mode;
+}
+#endif
+
+#ifdef LR11XX_RF_API_ADAPTIVE_TX_POWER
+/*******************************************************************/
+void LR11XX_RF_API_set_tx_power_policy(LR11XX_RF_API_tx_power_policy_cb_t policy_cb) {
+    lr1110_ctx.tx_power_policy_cb = policy_cb;
+}
+#endif
+
+#ifdef LR11XX_RF_API_ADAPTIVE_TX_POWER
+/*******************************************************************/
+void LR11XX_RF_API_reset_rssi_history(void) {
+    sfx_u8 idx = 0;
+    for (idx = 0; idx < LR11XX_RF_API_ADAPTIVE_TX_POWER_BANDS; idx++) {
+        lr1110_ctx.rssi_history[idx].rssi_count = 0;
+        lr1110_ctx.rssi_history[idx].power_reduction_db = 0;
     }
+}
+#endif
+
+#ifdef LR11XX_RF_API_BULK_MODE
+/*******************************************************************/
+void LR11XX_RF_API_bulk_start(void) {
+    lr1110_ctx.bulk_session = SIGFOX_TRUE;
+}
+#endif
+
+#ifdef LR11XX_RF_API_BULK_MODE
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_bulk_stop(void) {
 #ifdef SIGFOX_EP_ERROR_CODES
-    lr11xx_hw_api_status = LR11XX_HW_API_rx_on();
-    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+    RF_API_status_t status = RF_API_SUCCESS;
+#endif
+    lr1110_ctx.bulk_session = SIGFOX_FALSE;
+    lr1110_ctx.bulk_radio_valid = SIGFOX_FALSE;
+    if (lr1110_ctx.bulk_awake == SIGFOX_TRUE) {
+        // Apply the sleep which has been skipped at the end of the last message.
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = LR11XX_RF_API_sleep();
+        SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
 #else
-    LR11XX_HW_API_rx_on();
+        LR11XX_RF_API_sleep();
 #endif
-    lr11xx_status = lr11xx_radio_set_rx_with_timeout_in_rtc_step(SIGFOX_NULL, 0xFFFFFF);
-    if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
     }
-#ifndef SIGFOX_EP_ASYNCHRONOUS
-    while (1) {
-        if (lr1110_ctx.irq_flag == 1) {
 #ifdef SIGFOX_EP_ERROR_CODES
-            status = LR11XX_RF_API_process();
-            SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
-#else
-            LR11XX_RF_API_process();
+errors:
 #endif
-            if (lr1110_ctx.error_flag == 1) {
-                SIGFOX_EXIT_ERROR((RF_API_status_t) RF_API_ERROR);
-            }
-            if (lr1110_ctx.rx_done_flag == 1) {
-                rx_data->data_received = SIGFOX_TRUE;
-                break;
-            }
-        }
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef LR11XX_RF_API_STATISTICS
+/*******************************************************************/
+void LR11XX_RF_API_stats_spi_transfer(sfx_u16 transfer_size_bytes) {
+    lr1110_ctx.stats.spi_command_count[lr1110_ctx.stats_function]++;
+    lr1110_ctx.stats.spi_byte_count[lr1110_ctx.stats_function] += transfer_size_bytes;
+}
+#endif
+
+#ifdef LR11XX_RF_API_STATISTICS
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_get_stats(LR11XX_RF_API_stats_t *stats) {
 #ifdef SIGFOX_EP_ERROR_CODES
-        mcu_api_status = MCU_API_timer_status(MCU_API_TIMER_INSTANCE_T_RX, &timer_has_elapsed);
-        MCU_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_MCU_API);
-#else
-        MCU_API_timer_status(MCU_API_TIMER_INSTANCE_T_RX, &timer_has_elapsed);
+    RF_API_status_t status = RF_API_SUCCESS;
 #endif
-        if (timer_has_elapsed == SIGFOX_TRUE) {
-            break;
-        }
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (stats == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_NULL_PARAMETER);
     }
 #endif
+    (*stats) = lr1110_ctx.stats;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
 errors:
+#endif
     SIGFOX_RETURN();
 }
 #endif
 
-#ifdef SIGFOX_EP_BIDIRECTIONAL
+#ifdef LR11XX_RF_API_STATISTICS
 /*******************************************************************/
-RF_API_status_t LR11XX_RF_API_get_dl_phy_content_and_rssi(sfx_u8 *dl_phy_content, sfx_u8 dl_phy_content_size, sfx_s16 *dl_rssi_dbm) {
+void LR11XX_RF_API_reset_stats(void) {
+    sfx_u8 *stats_ptr = (sfx_u8 *) &lr1110_ctx.stats;
+    sfx_u32 idx = 0;
+    for (idx = 0; idx < sizeof(LR11XX_RF_API_stats_t); idx++) {
+        stats_ptr[idx] = 0;
+    }
+}
+#endif
+
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+/*******************************************************************/
+const LR11XX_RF_API_flight_recorder_t *LR11XX_RF_API_get_flight_recorder(void) {
+    return &lr11xx_flight_recorder;
+}
+#endif
+
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+/*******************************************************************/
+void LR11XX_RF_API_reset_flight_recorder(void) {
+    sfx_u8 *records_ptr = (sfx_u8 *) lr11xx_flight_recorder.records;
+    sfx_u32 idx = 0;
+    for (idx = 0; idx < sizeof(lr11xx_flight_recorder.records); idx++) {
+        records_ptr[idx] = 0;
+    }
+    lr11xx_flight_recorder.magic = LR11XX_RF_API_FLIGHT_RECORDER_MAGIC;
+    lr11xx_flight_recorder.index = 0;
+    lr11xx_flight_recorder.size = LR11XX_RF_API_FLIGHT_RECORDER;
+    lr11xx_flight_recorder.timestamp_us = 0;
+    LR11XX_HW_API_get_timestamp_us(&lr11xx_flight_recorder.timestamp_us);
+}
+#endif
+
+#ifdef LR11XX_RF_API_RTC_WAIT
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_start_rtc_wait(sfx_u32 duration_ms, LR11XX_RF_API_rtc_wait_cplt_cb_t cplt_cb) {
 #ifdef SIGFOX_EP_ERROR_CODES
     RF_API_status_t status = RF_API_SUCCESS;
 #endif
     lr11xx_status_t lr11xx_status;
-    lr11xx_radio_pkt_status_gfsk_t lr11xx_radio_pkt_status_gfsk;
-    lr11xx_radio_rx_buffer_status_t lr11xx_radio_rx_buffer_status;
+    lr11xx_system_sleep_cfg_t lr11xx_system_sleep_cfg;
+    sfx_u32 sleep_time = 0;
+#ifdef SIGFOX_EP_ERROR_CODES
+    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+#endif
 #ifdef SIGFOX_EP_PARAMETERS_CHECK
     // Check parameters.
-    if ((dl_phy_content == SIGFOX_NULL) || (dl_rssi_dbm == SIGFOX_NULL)) {
+    if (cplt_cb == SIGFOX_NULL) {
         SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_NULL_PARAMETER);
     }
-    if (dl_phy_content_size > SIGFOX_DL_PHY_CONTENT_SIZE_BYTES) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_BUFFER_SIZE);
+#endif
+    if ((duration_ms == 0) || (duration_ms > LR11XX_RF_API_RTC_WAIT_DURATION_MAX_MS)) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_RTC_WAIT);
     }
+    if (lr1110_ctx.rtc_wait_started == SIGFOX_TRUE) {
+#ifdef LR11XX_RF_API_STATISTICS
+        lr1110_ctx.stats.state_error_count++;
 #endif
-    if (lr1110_ctx.rx_done_flag != SIGFOX_TRUE) {
         SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_STATE);
     }
-    lr11xx_status = lr11xx_radio_get_gfsk_pkt_status(SIGFOX_NULL, &lr11xx_radio_pkt_status_gfsk);
-    if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+#ifdef LR11XX_RF_API_COEXISTENCE
+    if (lr1110_ctx.coex_owner == LR11XX_RF_API_COEX_OWNER_EXTERNAL) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_BUSY);
     }
-    if (lr11xx_radio_pkt_status_gfsk.is_received == 1) {
-        *dl_rssi_dbm = (sfx_s16) lr11xx_radio_pkt_status_gfsk.rssi_avg_in_dbm;
-        lr11xx_status = lr11xx_radio_get_rx_buffer_status(SIGFOX_NULL, &lr11xx_radio_rx_buffer_status);
-        if (lr11xx_status != LR11XX_STATUS_OK) {
-            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
-        }
-        lr11xx_regmem_read_buffer8(SIGFOX_NULL, dl_phy_content, lr11xx_radio_rx_buffer_status.buffer_start_pointer, dl_phy_content_size);
-        lr11xx_status = lr11xx_regmem_clear_rxbuffer(SIGFOX_NULL);
+#endif
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_OTHER;
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
+#else
+    _lr11xx_bus_acquire();
+#endif
+#endif
+    // Save the chip state to restore at the end of the wait.
+    lr1110_ctx.rtc_wait_asleep = (lr1110_ctx.irq_en == 0) ? SIGFOX_TRUE : SIGFOX_FALSE;
+#ifdef LR11XX_RF_API_BULK_MODE
+    if (lr1110_ctx.bulk_awake == SIGFOX_TRUE) {
+        lr1110_ctx.rtc_wait_asleep = SIGFOX_FALSE;
+    }
+#endif
+#ifdef LR11XX_RF_API_POWER_POLICY
+    if (lr1110_ctx.gap_mode == LR11XX_RF_API_GAP_MODE_SLEEP) {
+        lr1110_ctx.rtc_wait_asleep = SIGFOX_TRUE;
+    }
+#endif
+    if (lr1110_ctx.rtc_wait_asleep == SIGFOX_TRUE) {
+        lr11xx_status = lr11xx_system_wakeup(SIGFOX_NULL);
         if (lr11xx_status != LR11XX_STATUS_OK) {
-            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_REGMEM_REG);
+            SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_WAKEUP);
         }
     }
+    // Route the chip wake-up to the IRQ callback before the sleep command, so that a short wait can not be missed.
+#ifdef SIGFOX_EP_ERROR_CODES
+    lr11xx_hw_api_status = LR11XX_HW_API_rtc_wait_irq_enable(SIGFOX_TRUE);
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+#else
+    LR11XX_HW_API_rtc_wait_irq_enable(SIGFOX_TRUE);
+#endif
+    lr1110_ctx.rtc_wait_irq_en = lr1110_ctx.irq_en;
+    lr1110_ctx.irq_en = 0;
+    lr1110_ctx.rtc_wait_cplt_cb = cplt_cb;
+    lr1110_ctx.rtc_wait_started = SIGFOX_TRUE;
+    lr1110_ctx.rtc_wait_running = SIGFOX_TRUE;
+    // Sleep time is given in RTC steps (the duration is checked so that it can not overflow), the configuration is retained so that the RF API state is not changed by the wait.
+    sleep_time = ((duration_ms / 1000) * LR11XX_RF_API_RTC_FREQUENCY_HZ) + (((duration_ms % 1000) * LR11XX_RF_API_RTC_FREQUENCY_HZ) / 1000);
+    lr11xx_system_sleep_cfg.is_warm_start = 1;
+    lr11xx_system_sleep_cfg.is_rtc_timeout = 1;
+    lr11xx_status = lr11xx_system_set_sleep(SIGFOX_NULL, lr11xx_system_sleep_cfg, sleep_time);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        lr1110_ctx.rtc_wait_running = SIGFOX_FALSE;
+        lr1110_ctx.rtc_wait_started = SIGFOX_FALSE;
+        lr1110_ctx.irq_en = lr1110_ctx.rtc_wait_irq_en;
+        LR11XX_HW_API_rtc_wait_irq_enable(SIGFOX_FALSE);
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
+    }
 errors:
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
     SIGFOX_RETURN();
 }
 #endif
 
-#if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_LBT)
+#ifdef LR11XX_RF_API_RTC_WAIT
 /*******************************************************************/
-RF_API_status_t LR11XX_RF_API_carrier_sense(RF_API_carrier_sense_parameters_t *carrier_sense_params) {
-    /* To be implemented by the device manufacturer */
+RF_API_status_t LR11XX_RF_API_stop_rtc_wait(void) {
 #ifdef SIGFOX_EP_ERROR_CODES
     RF_API_status_t status = RF_API_SUCCESS;
 #endif
-    SIGFOX_UNUSED(carrier_sense_params);
-    SIGFOX_RETURN();
-}
-#endif
-
-#if (defined SIGFOX_EP_TIMER_REQUIRED) && (defined SIGFOX_EP_LATENCY_COMPENSATION)
-/*******************************************************************/
-RF_API_status_t LR11XX_RF_API_get_latency(RF_API_latency_t latency_type, sfx_u32 *latency_ms) {
+    lr11xx_status_t lr11xx_status;
+    lr11xx_system_sleep_cfg_t lr11xx_system_sleep_cfg;
 #ifdef SIGFOX_EP_ERROR_CODES
-    RF_API_status_t status = RF_API_SUCCESS;
     LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
 #endif
-    sfx_u32 latency_tmp = 0;
-    switch (latency_type) {
-    case RF_API_LATENCY_WAKE_UP:
-        *latency_ms = 532;
+    if (lr1110_ctx.rtc_wait_started == SIGFOX_FALSE) {
+#ifdef LR11XX_RF_API_STATISTICS
+        lr1110_ctx.stats.state_error_count++;
+#endif
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_STATE);
+    }
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_OTHER;
+#endif
+    // Ignore the wake-up of an aborted wait.
+    lr1110_ctx.rtc_wait_running = SIGFOX_FALSE;
+    lr1110_ctx.rtc_wait_started = SIGFOX_FALSE;
+    lr1110_ctx.irq_en = lr1110_ctx.rtc_wait_irq_en;
+    // Give the IRQ line back to the radio interrupts.
 #ifdef SIGFOX_EP_ERROR_CODES
-        lr11xx_hw_api_status = LR11XX_HW_API_get_latency(LR11XX_HW_API_LATENCY_RESET, &latency_tmp);
-        LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+    lr11xx_hw_api_status = LR11XX_HW_API_rtc_wait_irq_enable(SIGFOX_FALSE);
+    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
 #else
-        LR11XX_HW_API_get_latency(LR11XX_HW_API_LATENCY_RESET, &latency_tmp);
+    LR11XX_HW_API_rtc_wait_irq_enable(SIGFOX_FALSE);
 #endif
-        (*latency_ms) += latency_tmp;
+#ifdef LR11XX_RF_API_SHARED_BUS
 #ifdef SIGFOX_EP_ERROR_CODES
-        lr11xx_hw_api_status = LR11XX_HW_API_get_latency(LR11XX_HW_API_LATENCY_WAKEUP, &latency_tmp);
-        LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
+    status = _lr11xx_bus_acquire();
+    SIGFOX_CHECK_STATUS(RF_API_SUCCESS);
 #else
-        LR11XX_HW_API_get_latency(LR11XX_HW_API_LATENCY_RESET, &latency_tmp);
+    _lr11xx_bus_acquire();
 #endif
-        (*latency_ms) += latency_tmp;
-        break;
-    case RF_API_LATENCY_INIT_TX:
-        *latency_ms = T_RADIO_DELAY_ON;
-        break;
-    case RF_API_LATENCY_SEND_START:
-        *latency_ms = (T_RADIO_BIT_LATENCY_ON * 1000) / lr1110_ctx.backup_bit_rate_bps_patch;
-        break;
-    case RF_API_LATENCY_SEND_STOP:
-        *latency_ms = (T_RADIO_BIT_LATENCY_OFF * 1000) / lr1110_ctx.backup_bit_rate_bps_patch;
-        break;
-    case RF_API_LATENCY_DE_INIT_TX:
-        *latency_ms = 0;
-        break;
-    case RF_API_LATENCY_SLEEP:
-        *latency_ms = 0;
-        break;
-#ifdef SIGFOX_EP_BIDIRECTIONAL
-    case RF_API_LATENCY_INIT_RX:
-        *latency_ms = 0;
-        break;
-    case RF_API_LATENCY_RECEIVE_START:
-        *latency_ms = 0;
-        break;
-    case RF_API_LATENCY_RECEIVE_STOP:
-        *latency_ms = 5;
-        break;
-    case RF_API_LATENCY_DE_INIT_RX:
-        *latency_ms = 0;
-        break;
 #endif
-    default:
-        *latency_ms = 0;
+    // The chip is in RC standby after the RTC wake-up, or still asleep if the wait is aborted.
+    lr11xx_status = lr11xx_system_wakeup(SIGFOX_NULL);
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_WAKEUP);
+    }
+    if (lr1110_ctx.rtc_wait_asleep == SIGFOX_TRUE) {
+        lr11xx_system_sleep_cfg.is_warm_start = (lr1110_ctx.chip_configured == SIGFOX_TRUE) ? 1 : 0;
+        lr11xx_system_sleep_cfg.is_rtc_timeout = 0;
+        lr11xx_status = lr11xx_system_set_sleep(SIGFOX_NULL, lr11xx_system_sleep_cfg, 0);
+    } else {
+#ifdef LR11XX_RF_API_POWER_POLICY
+        lr1110_ctx.gap_mode = LR11XX_RF_API_GAP_MODE_STANDBY_XOSC;
+#endif
+        lr11xx_status = lr11xx_system_set_standby(SIGFOX_NULL, LR11XX_SYSTEM_STANDBY_CFG_XOSC);
+    }
+    if (lr11xx_status != LR11XX_STATUS_OK) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_SYSTEM_REG);
     }
-#ifdef SIGFOX_EP_ERROR_CODES
 errors:
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
 #endif
     SIGFOX_RETURN();
 }
 #endif
 
-#ifdef SIGFOX_EP_CERTIFICATION
+#if (defined SIGFOX_EP_BIDIRECTIONAL) && (defined LR11XX_RF_API_DL_VALIDATION)
 /*******************************************************************/
-RF_API_status_t LR11XX_RF_API_start_continuous_wave(void) {
-#ifdef SIGFOX_EP_ERROR_CODES
-    RF_API_status_t status = RF_API_SUCCESS;
-    LR11XX_HW_API_status_t lr11xx_hw_api_status = LR11XX_HW_API_SUCCESS;
+void LR11XX_RF_API_set_dl_validation(LR11XX_RF_API_dl_validation_cb_t validation_cb) {
+    lr1110_ctx.dl_validation_cb = validation_cb;
+}
 #endif
-    lr11xx_status_t lr11xx_status;
 
+#if (defined SIGFOX_EP_BIDIRECTIONAL) && (defined LR11XX_RF_API_DL_VALIDATION)
+/*******************************************************************/
+RF_API_status_t LR11XX_RF_API_get_dl_rejected_count(sfx_u32 *dl_rejected_count, sfx_bool reset) {
 #ifdef SIGFOX_EP_ERROR_CODES
-    lr11xx_hw_api_status = LR11XX_HW_API_tx_on();
-    LR11XX_HW_API_check_status((RF_API_status_t) LR11XX_RF_API_ERROR_DRIVER_LR11XX_HW_API);
-#else
-    LR11XX_HW_API_tx_on();
+    RF_API_status_t status = RF_API_SUCCESS;
 #endif
-    // Start radio.
-    lr11xx_status = lr11xx_radio_set_tx_cw(SIGFOX_NULL);
-    if (lr11xx_status != LR11XX_STATUS_OK) {
-        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_RADIO_REG);
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (dl_rejected_count == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR((RF_API_status_t) LR11XX_RF_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    (*dl_rejected_count) = lr1110_ctx.dl_rejected_count;
+    if (reset == SIGFOX_TRUE) {
+        lr1110_ctx.dl_rejected_count = 0;
     }
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
 errors:
+#endif
     SIGFOX_RETURN();
 }
 #endif
@@ -870,7 +4336,59 @@ RF_API_status_t LR11XX_RF_API_get_version(sfx_u8 **version, sfx_u8 *version_size
 
 #ifdef SIGFOX_EP_ERROR_CODES
 void LR11XX_RF_API_error(void) {
+#ifdef LR11XX_RF_API_STATISTICS
+    lr1110_ctx.stats_function = LR11XX_RF_API_FUNCTION_ERROR;
+#endif
+#ifdef LR11XX_RF_API_FLIGHT_RECORDER
+    _lr11xx_flight_record(LR11XX_RF_API_FLIGHT_EVENT_ENTRY, LR11XX_RF_API_FUNCTION_ERROR, 0);
+#endif
+#ifdef LR11XX_RF_API_COEXISTENCE
+    // The chip and the bus belong to the external user (wake-up rejected): do not abort its operation.
+    if (lr1110_ctx.coex_owner == LR11XX_RF_API_COEX_OWNER_EXTERNAL) {
+        return;
+    }
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_acquire();
+#endif
     lr11xx_regmem_clear_rxbuffer(SIGFOX_NULL);
+#ifdef LR11XX_RF_API_ERROR_RECOVERY
+    lr1110_ctx.radio_cmd = RADIO_CMD_NONE;
+    // Recalibrate the faulty block only, a cold start is forced at next wake-up if the fault can not be recovered.
+    if ((lr1110_ctx.chip_configured == SIGFOX_TRUE) && (_lr11xx_recover() == SIGFOX_TRUE)) {
+        lr1110_ctx.recovered = SIGFOX_TRUE;
+    } else {
+        lr1110_ctx.chip_configured = SIGFOX_FALSE;
+    }
+#else
+    // Chip state is unknown after an error: force a cold start at next wake-up.
+    lr1110_ctx.chip_configured = SIGFOX_FALSE;
+#endif
+#ifdef LR11XX_RF_API_SWEEP
+    lr1110_ctx.sweep_running = SIGFOX_FALSE;
+#endif
+#ifdef LR11XX_RF_API_SPECTRUM_SCAN
+    lr1110_ctx.scan_running = SIGFOX_FALSE;
+#endif
+#ifdef LR11XX_RF_API_ASYNC_HAL
+    // A completion callback of an aborted transfer is ignored.
+    lr1110_ctx.hal_operation = HAL_OPERATION_NONE;
+    lr1110_ctx.hal_cplt_flag = 0;
+#endif
+#ifdef LR11XX_RF_API_BULK_MODE
+    lr1110_ctx.bulk_radio_valid = SIGFOX_FALSE;
+#endif
+#ifdef LR11XX_RF_API_RTC_WAIT
+    if (lr1110_ctx.rtc_wait_started == SIGFOX_TRUE) {
+        lr1110_ctx.irq_en = lr1110_ctx.rtc_wait_irq_en;
+        LR11XX_HW_API_rtc_wait_irq_enable(SIGFOX_FALSE);
+    }
+    lr1110_ctx.rtc_wait_started = SIGFOX_FALSE;
+    lr1110_ctx.rtc_wait_running = SIGFOX_FALSE;
+#endif
+#ifdef LR11XX_RF_API_SHARED_BUS
+    _lr11xx_bus_release();
+#endif
     LR11XX_RF_API_de_init();
     LR11XX_RF_API_sleep();
 }
@@ -36,3 +36,178 @@ void dbpsk_encode_buffer(const uint8_t *data_in, int bpsk_pld_len_in_bits, uint8
     out_byte = (out_byte << 1) | current;
     *data_out = out_byte << (7 - ((bpsk_pld_len_in_bits + 1) & 7));
 }
+
+void dbpsk_encode_chunk(dbpsk_encoder_t *encoder, const uint8_t *data_in, int len_in_bytes, uint8_t *data_out) {
+    uint8_t in_byte = 0x00;
+    uint8_t out_byte = 0x00;
+    uint8_t current = encoder->current;
+
+    while (--len_in_bytes >= 0) {
+        in_byte = *data_in++;
+        for (int i = 0; i < 8; ++i) {
+            out_byte = (out_byte << 1) | current;
+            if ((in_byte & 0x80) == 0) {
+                current = current ^ 0x01;
+            }
+            in_byte <<= 1;
+        }
+        *data_out++ = out_byte;
+    }
+    encoder->current = current;
+}
+
+void dbpsk_encode_tail(dbpsk_encoder_t *encoder, uint8_t tail_byte, int tail_len_in_bits, uint8_t *data_out) {
+    uint8_t out_byte = 0x00;
+    uint8_t current = encoder->current;
+
+    // Process remaining bits
+    for (int i = 0; i < tail_len_in_bits; ++i) {
+        out_byte = (out_byte << 1) | current;
+        if ((tail_byte & 0x80) == 0) {
+            current = current ^ 0x01;
+        }
+        tail_byte <<= 1;
+    }
+    // Process last data bit
+    out_byte = (out_byte << 1) | current;
+    if (tail_len_in_bits == 7) {
+        *data_out++ = out_byte;
+    }
+    // Add duplicate bit and store
+    out_byte = (out_byte << 1) | current;
+    *data_out = out_byte << (7 - ((tail_len_in_bits + 1) & 7));
+    encoder->current = current;
+}
+
+#ifdef SMTC_DBPSK_BATCH
+static inline uint64_t dbpsk_prefix_xor(uint64_t phase_change) {
+#ifdef SMTC_DBPSK_BATCH_SCALAR
+    uint64_t prefix = 0;
+    uint64_t current = 0;
+
+    // Inclusive prefix XOR from the MSB, one bit at a time
+    for (int i = 63; i >= 0; --i) {
+        current ^= (phase_change >> i) & 0x01;
+        prefix |= current << i;
+    }
+    return prefix;
+#else
+    // Inclusive prefix XOR from the MSB
+    phase_change ^= phase_change >> 1;
+    phase_change ^= phase_change >> 2;
+    phase_change ^= phase_change >> 4;
+    phase_change ^= phase_change >> 8;
+    phase_change ^= phase_change >> 16;
+    phase_change ^= phase_change >> 32;
+    return phase_change;
+#endif
+}
+
+static inline uint64_t dbpsk_word_mask(int len_in_bits) {
+    // First len_in_bits bits of a word, from the MSB
+    if (len_in_bits <= 0) {
+        return 0;
+    }
+    return (len_in_bits >= 64) ? UINT64_MAX : (UINT64_MAX << (64 - len_in_bits));
+}
+
+static inline uint64_t dbpsk_encode_lane(uint64_t current, uint64_t data_in, uint64_t in_mask, uint64_t out_mask) {
+    // A 0 changes the phase, bits after the end of the frame do not
+    uint64_t phase_change = dbpsk_prefix_xor(~data_in & in_mask);
+    // Each output bit is the phase before the corresponding input bit
+    return (current ^ (phase_change >> 1)) & out_mask;
+}
+
+#ifndef SMTC_DBPSK_BATCH_SCALAR
+static void dbpsk_encode_words(dbpsk_encoder_t *encoder, const uint8_t *data_in, int len_in_words, uint8_t *data_out) {
+    uint64_t phase_change = 0;
+    uint64_t current = (encoder->current != 0) ? UINT64_MAX : 0;
+
+    while (--len_in_words >= 0) {
+        // Big endian load, first bit of the word is the MSB
+        phase_change = 0;
+        for (int i = 0; i < 8; ++i) {
+            phase_change = (phase_change << 8) | *data_in++;
+        }
+        // A 0 changes the phase
+        phase_change = dbpsk_prefix_xor(~phase_change);
+        // Each output bit is the phase before the corresponding input bit
+        uint64_t out_word = current ^ (phase_change >> 1);
+        for (int i = 7; i >= 0; --i) {
+            *data_out++ = (uint8_t) (out_word >> (i * 8));
+        }
+        current ^= (phase_change & 0x01) ? UINT64_MAX : 0;
+    }
+    encoder->current = (uint8_t) (current & 0x01);
+}
+#endif
+
+void dbpsk_encode_batch(const uint8_t *data_in, int data_in_stride, int bpsk_pld_len_in_bits, int frame_count, uint8_t *data_out, int data_out_stride) {
+    dbpsk_encoder_t encoder;
+    int len_in_bytes = bpsk_pld_len_in_bits >> 3;
+
+    for (int n = 0; n < frame_count; ++n) {
+        const uint8_t *frame_in = data_in + (n * data_in_stride);
+        uint8_t *frame_out = data_out + (n * data_out_stride);
+        dbpsk_encoder_init(&encoder);
+#ifdef SMTC_DBPSK_BATCH_SCALAR
+        dbpsk_encode_chunk(&encoder, frame_in, len_in_bytes, frame_out);
+#else
+        int len_in_words = len_in_bytes >> 3;
+        dbpsk_encode_words(&encoder, frame_in, len_in_words, frame_out);
+        dbpsk_encode_chunk(&encoder, frame_in + (len_in_words << 3), len_in_bytes & 7, frame_out + (len_in_words << 3));
+#endif
+        dbpsk_encode_tail(&encoder, ((bpsk_pld_len_in_bits & 7) != 0) ? frame_in[len_in_bytes] : 0x00, bpsk_pld_len_in_bits & 7, frame_out + len_in_bytes);
+    }
+}
+
+void dbpsk_encode_batch_soa(const uint64_t *data_in, int bpsk_pld_len_in_bits, int frame_count, uint64_t *data_out) {
+    int len_in_words = dbpsk_get_batch_soa_len_in_words(bpsk_pld_len_in_bits);
+    uint64_t in_mask = dbpsk_word_mask(bpsk_pld_len_in_bits);
+    uint64_t previous_in_mask = 0;
+    uint64_t out_mask = dbpsk_word_mask(bpsk_pld_len_in_bits + 2);
+
+    // Frames are independent lanes: the inner loops have no dependency between iterations
+    for (int n = 0; n < frame_count; ++n) {
+        data_out[n] = dbpsk_encode_lane(0, data_in[n], in_mask, out_mask);
+    }
+    for (int w = 1; w < len_in_words; ++w) {
+        const uint64_t *previous_in = data_in + ((w - 1) * frame_count);
+        const uint64_t *previous_out = data_out + ((w - 1) * frame_count);
+        uint64_t *word_out = data_out + (w * frame_count);
+        previous_in_mask = in_mask;
+        in_mask = dbpsk_word_mask(bpsk_pld_len_in_bits - (w << 6));
+        out_mask = dbpsk_word_mask(bpsk_pld_len_in_bits + 2 - (w << 6));
+        // The last output word can follow the last input word, it only holds the final phase
+        const uint64_t *word_in = (in_mask != 0) ? (data_in + (w * frame_count)) : previous_in;
+
+        for (int n = 0; n < frame_count; ++n) {
+            // Phase after the last bit of the previous word, on all the bits
+            uint64_t current = 0 - ((previous_out[n] ^ (~previous_in[n] & previous_in_mask)) & 0x01);
+            word_out[n] = dbpsk_encode_lane(current, word_in[n], in_mask, out_mask);
+        }
+    }
+}
+#endif
+
+void dbpsk_decode_buffer(const uint8_t *data_in, int bpsk_pld_len_in_bits, uint8_t *data_out) {
+    uint8_t out_byte = 0x00;
+    uint8_t previous = (data_in[0] >> 7) & 0x01;
+    uint8_t current = 0;
+
+    for (int i = 0; i < bpsk_pld_len_in_bits; ++i) {
+        // Phase of the symbol following data bit i
+        current = (data_in[(i + 1) >> 3] >> (7 - ((i + 1) & 7))) & 0x01;
+        // A phase change encodes a 0
+        out_byte = (out_byte << 1) | ((current == previous) ? 0x01 : 0x00);
+        previous = current;
+        if ((i & 7) == 7) {
+            *data_out++ = out_byte;
+            out_byte = 0x00;
+        }
+    }
+    // Store remaining bits, left aligned
+    if ((bpsk_pld_len_in_bits & 7) != 0) {
+        *data_out = out_byte << (8 - (bpsk_pld_len_in_bits & 7));
+    }
+}
@@ -0,0 +1,227 @@
+/*!*****************************************************************
+ * \file    test_lr11xx_hw_api_virtual_time.c
+ * \brief   Virtual time host test: event scheduling, IRQ delivery and MCU API timers.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2024, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sigfox_types.h"
+#include "manuf/mcu_api.h"
+#include "board/lr11xx_hw_api.h"
+#include "board/lr11xx_hw_api_virtual_time.h"
+
+#define TEST_EVENT_A    (LR11XX_HW_API_VIRTUAL_TIME_EVENT_USER + 0)
+#define TEST_EVENT_B    (LR11XX_HW_API_VIRTUAL_TIME_EVENT_USER + 1)
+#define TEST_EVENT_C    (LR11XX_HW_API_VIRTUAL_TIME_EVENT_USER + 2)
+#define TEST_TRACE_SIZE 8
+
+static unsigned int test_count = 0;
+static unsigned int test_failure_count = 0;
+// Expiry order and simulated time seen by the event callbacks.
+static sfx_u8 trace[TEST_TRACE_SIZE];
+static uint64_t trace_time_us[TEST_TRACE_SIZE];
+static sfx_u8 trace_size = 0;
+static unsigned int gpio_irq_count = 0;
+
+/*******************************************************************/
+static void _check(int condition, const char *test_name) {
+    test_count++;
+    if (condition == 0) {
+        test_failure_count++;
+        printf("FAIL %s\n", test_name);
+    }
+}
+
+/*******************************************************************/
+static void _trace(sfx_u8 event_id) {
+    if (trace_size < TEST_TRACE_SIZE) {
+        trace[trace_size] = event_id;
+        trace_time_us[trace_size] = LR11XX_HW_API_VIRTUAL_TIME_get_time_us();
+        trace_size++;
+    }
+}
+
+/*******************************************************************/
+static void _event_a_cb(void) {
+    _trace(TEST_EVENT_A);
+}
+
+/*******************************************************************/
+static void _event_b_cb(void) {
+    _trace(TEST_EVENT_B);
+}
+
+/*******************************************************************/
+static void _event_c_cb(void) {
+    _trace(TEST_EVENT_C);
+}
+
+/*******************************************************************/
+static void _gpio_irq_cb(void) {
+    gpio_irq_count++;
+}
+
+/*******************************************************************/
+static void _reset(void) {
+    LR11XX_HW_API_VIRTUAL_TIME_reset();
+    trace_size = 0;
+    gpio_irq_count = 0;
+}
+
+/*******************************************************************/
+static void _test_advance(void) {
+    _reset();
+    LR11XX_HW_API_VIRTUAL_TIME_set_event(TEST_EVENT_A, 300, &_event_a_cb);
+    LR11XX_HW_API_VIRTUAL_TIME_set_event(TEST_EVENT_B, 100, &_event_b_cb);
+    LR11XX_HW_API_VIRTUAL_TIME_set_event(TEST_EVENT_C, 1000, &_event_c_cb);
+    // Only the events falling in the interval expire, in chronological order, at their own time.
+    LR11XX_HW_API_VIRTUAL_TIME_advance(500);
+    _check(LR11XX_HW_API_VIRTUAL_TIME_get_time_us() == 500, "advance time");
+    _check(trace_size == 2, "advance expired events");
+    _check((trace[0] == TEST_EVENT_B) && (trace[1] == TEST_EVENT_A), "advance order");
+    _check((trace_time_us[0] == 100) && (trace_time_us[1] == 300), "advance event times");
+    _check(LR11XX_HW_API_VIRTUAL_TIME_is_event_pending(TEST_EVENT_A) == SIGFOX_FALSE, "advance expired event not pending");
+    _check(LR11XX_HW_API_VIRTUAL_TIME_is_event_pending(TEST_EVENT_C) == SIGFOX_TRUE, "advance later event pending");
+    // An event expiring exactly at the end of the interval is included.
+    LR11XX_HW_API_VIRTUAL_TIME_advance(500);
+    _check((trace_size == 3) && (trace[2] == TEST_EVENT_C) && (trace_time_us[2] == 1000), "advance interval end");
+}
+
+/*******************************************************************/
+static void _test_run_next_event(void) {
+    _reset();
+    LR11XX_HW_API_VIRTUAL_TIME_set_event(TEST_EVENT_A, 2000, &_event_a_cb);
+    LR11XX_HW_API_VIRTUAL_TIME_set_event(TEST_EVENT_B, 700, &_event_b_cb);
+    _check(LR11XX_HW_API_VIRTUAL_TIME_run_next_event() == SIGFOX_TRUE, "run next event");
+    _check((trace_size == 1) && (trace[0] == TEST_EVENT_B), "run next event earliest");
+    _check(LR11XX_HW_API_VIRTUAL_TIME_get_time_us() == 700, "run next event time");
+    _check(LR11XX_HW_API_VIRTUAL_TIME_run_next_event() == SIGFOX_TRUE, "run next event second");
+    _check(LR11XX_HW_API_VIRTUAL_TIME_get_time_us() == 2000, "run next event second time");
+    _check(LR11XX_HW_API_VIRTUAL_TIME_run_next_event() == SIGFOX_FALSE, "run next event empty");
+    _check(LR11XX_HW_API_VIRTUAL_TIME_get_time_us() == 2000, "run next event empty time");
+}
+
+/*******************************************************************/
+static void _test_ordering(void) {
+    _reset();
+    // Equal expiry times: the lowest identifier first, whatever the scheduling order.
+    LR11XX_HW_API_VIRTUAL_TIME_set_event(TEST_EVENT_C, 400, &_event_c_cb);
+    LR11XX_HW_API_VIRTUAL_TIME_set_event(TEST_EVENT_A, 400, &_event_a_cb);
+    LR11XX_HW_API_VIRTUAL_TIME_set_event(TEST_EVENT_B, 400, &_event_b_cb);
+    LR11XX_HW_API_VIRTUAL_TIME_advance(400);
+    _check(trace_size == 3, "ordering expired events");
+    _check((trace[0] == TEST_EVENT_A) && (trace[1] == TEST_EVENT_B) && (trace[2] == TEST_EVENT_C), "ordering equal times");
+}
+
+/*******************************************************************/
+static void _test_replacement(void) {
+    _reset();
+    LR11XX_HW_API_VIRTUAL_TIME_set_event(TEST_EVENT_A, 100, &_event_a_cb);
+    LR11XX_HW_API_VIRTUAL_TIME_advance(50);
+    // Scheduling the same identifier again replaces the deadline and the callback.
+    LR11XX_HW_API_VIRTUAL_TIME_set_event(TEST_EVENT_A, 500, &_event_b_cb);
+    LR11XX_HW_API_VIRTUAL_TIME_advance(100);
+    _check(trace_size == 0, "replacement old deadline");
+    LR11XX_HW_API_VIRTUAL_TIME_advance(400);
+    _check((trace_size == 1) && (trace[0] == TEST_EVENT_B) && (trace_time_us[0] == 550), "replacement new deadline");
+    // Cancelled events never expire.
+    LR11XX_HW_API_VIRTUAL_TIME_set_event(TEST_EVENT_C, 10, &_event_c_cb);
+    LR11XX_HW_API_VIRTUAL_TIME_cancel_event(TEST_EVENT_C);
+    _check(LR11XX_HW_API_VIRTUAL_TIME_run_next_event() == SIGFOX_FALSE, "cancel");
+    _check(trace_size == 1, "cancel callback");
+}
+
+/*******************************************************************/
+static void _test_raise_irq(void) {
+    LR11XX_HW_API_config_t hw_api_config;
+    LR11XX_HW_API_status_t status = LR11XX_HW_API_SUCCESS;
+    _reset();
+    memset(&hw_api_config, 0x00, sizeof(hw_api_config));
+    hw_api_config.gpio_irq_callback = &_gpio_irq_cb;
+    LR11XX_HW_API_VIRTUAL_TIME_open(&hw_api_config);
+    // The IRQ is delivered to the callback registered at open, after the simulated operation duration.
+    LR11XX_HW_API_VIRTUAL_TIME_raise_irq(12000);
+    LR11XX_HW_API_VIRTUAL_TIME_advance(11999);
+    _check(gpio_irq_count == 0, "raise irq before duration");
+    LR11XX_HW_API_VIRTUAL_TIME_advance(1);
+    _check(gpio_irq_count == 1, "raise irq delivered");
+    // The blocking wait jumps to the IRQ.
+    LR11XX_HW_API_VIRTUAL_TIME_raise_irq(3000);
+    status = LR11XX_HW_API_wait_irq();
+    _check(status == LR11XX_HW_API_SUCCESS, "wait irq");
+    _check((gpio_irq_count == 2) && (LR11XX_HW_API_VIRTUAL_TIME_get_time_us() == 15000), "wait irq delivered");
+    // Nothing is scheduled: the wait fails instead of spinning.
+    status = LR11XX_HW_API_wait_irq();
+    _check(status == LR11XX_HW_API_ERROR, "wait irq without event");
+}
+
+/*******************************************************************/
+static void _test_mcu_api_timers(void) {
+    MCU_API_timer_t timer;
+    MCU_API_status_t status = MCU_API_SUCCESS;
+    sfx_bool timer_has_elapsed = SIGFOX_FALSE;
+    _reset();
+    memset(&timer, 0x00, sizeof(timer));
+    timer.instance = MCU_API_TIMER_INSTANCE_T_W;
+    timer.duration_ms = 20;
+    status = MCU_API_timer_start(&timer);
+    _check(status == MCU_API_SUCCESS, "timer start");
+    // A chip model event is expired on the way.
+    LR11XX_HW_API_VIRTUAL_TIME_set_event(TEST_EVENT_A, 5000, &_event_a_cb);
+    status = MCU_API_timer_status(MCU_API_TIMER_INSTANCE_T_W, &timer_has_elapsed);
+    _check((status == MCU_API_SUCCESS) && (timer_has_elapsed == SIGFOX_FALSE) && (trace_size == 1), "timer status running");
+    status = MCU_API_timer_wait_cplt(MCU_API_TIMER_INSTANCE_T_W);
+    _check(status == MCU_API_SUCCESS, "timer wait completion");
+    _check(LR11XX_HW_API_VIRTUAL_TIME_get_time_us() == 20000, "timer wait completion time");
+    status = MCU_API_timer_status(MCU_API_TIMER_INSTANCE_T_W, &timer_has_elapsed);
+    _check((status == MCU_API_SUCCESS) && (timer_has_elapsed == SIGFOX_TRUE), "timer status elapsed");
+    // Stopped timer does not expire.
+    status = MCU_API_timer_start(&timer);
+    status = MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_T_W);
+    _check((status == MCU_API_SUCCESS) && (LR11XX_HW_API_VIRTUAL_TIME_run_next_event() == SIGFOX_FALSE), "timer stop");
+}
+
+/*******************************************************************/
+int main(void) {
+    _test_advance();
+    _test_run_next_event();
+    _test_ordering();
+    _test_replacement();
+    _test_raise_irq();
+    _test_mcu_api_timers();
+    printf("%u checks, %u failures\n", test_count, test_failure_count);
+    return (test_failure_count == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,218 @@
+/*!*****************************************************************
+ * \file    bench_dbpsk.c
+ * \brief   DBPSK encoder microbenchmark (ns/frame, frames/s and cycles/bit).
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2024, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#if (defined __x86_64__) || (defined __i386__)
+#include <x86intrin.h>
+#define BENCH_DBPSK_CYCLES
+#endif
+
+#include "manuf/smtc_dbpsk.h"
+
+// Largest Sigfox uplink bitstream (SIGFOX_UL_BITSTREAM_SIZE_BYTES).
+#define BENCH_DBPSK_UL_BITSTREAM_SIZE_BYTES_MAX 26
+#define BENCH_DBPSK_BUFFER_SIZE_BYTES (BENCH_DBPSK_UL_BITSTREAM_SIZE_BYTES_MAX + 2)
+#define BENCH_DBPSK_FRAME_COUNT_DEFAULT 1000000
+// Tail appended by LR11XX_RF_API_send() after the bitstream.
+#define BENCH_DBPSK_TAIL_BYTE 0x80
+#define BENCH_DBPSK_TAIL_SIZE_BITS 2
+
+#ifdef SMTC_DBPSK_BATCH
+// Number of frames given to each dbpsk_encode_batch() call.
+#define BENCH_DBPSK_BATCH_FRAMES 256
+// Structure of arrays arenas, in 64-bit words per frame.
+#define BENCH_DBPSK_BATCH_SOA_WORDS (((BENCH_DBPSK_UL_BITSTREAM_SIZE_BYTES_MAX * 8) + BENCH_DBPSK_TAIL_SIZE_BITS + 65) >> 6)
+#ifdef SMTC_DBPSK_BATCH_SCALAR
+#define BENCH_DBPSK_BATCH_NAME "batch_scalar"
+#define BENCH_DBPSK_BATCH_SOA_NAME "batch_soa_sc"
+#else
+#define BENCH_DBPSK_BATCH_NAME "batch_words"
+#define BENCH_DBPSK_BATCH_SOA_NAME "batch_soa"
+#endif
+#endif
+
+typedef enum {
+    BENCH_DBPSK_ENCODER_BUFFER = 0,
+    BENCH_DBPSK_ENCODER_CHUNK,
+#ifdef SMTC_DBPSK_BATCH
+    BENCH_DBPSK_ENCODER_BATCH,
+    BENCH_DBPSK_ENCODER_BATCH_SOA,
+#endif
+    BENCH_DBPSK_ENCODER_LAST
+} bench_dbpsk_encoder_t;
+
+static const char *BENCH_DBPSK_ENCODER_NAME[BENCH_DBPSK_ENCODER_LAST] = {
+    "encode_buffer",
+    "encode_chunk",
+#ifdef SMTC_DBPSK_BATCH
+    BENCH_DBPSK_BATCH_NAME,
+    BENCH_DBPSK_BATCH_SOA_NAME,
+#endif
+};
+
+// Output is accumulated to prevent the compiler from removing the encoding.
+static volatile uint8_t bench_sink = 0;
+#ifdef SMTC_DBPSK_BATCH
+static uint8_t batch_in[BENCH_DBPSK_BATCH_FRAMES * BENCH_DBPSK_BUFFER_SIZE_BYTES];
+static uint8_t batch_out[BENCH_DBPSK_BATCH_FRAMES * BENCH_DBPSK_BUFFER_SIZE_BYTES];
+static uint64_t batch_soa_in[BENCH_DBPSK_BATCH_FRAMES * BENCH_DBPSK_BATCH_SOA_WORDS];
+static uint64_t batch_soa_out[BENCH_DBPSK_BATCH_FRAMES * BENCH_DBPSK_BATCH_SOA_WORDS];
+#endif
+
+/*******************************************************************/
+static double _get_time_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((double) now.tv_sec * 1e9) + (double) now.tv_nsec;
+}
+
+#ifdef SMTC_DBPSK_BATCH
+/*******************************************************************/
+static void _encode_batches(int bitstream_size_bytes, long frame_count) {
+    long frame = 0;
+    int batch_frame_count = 0;
+    int idx = 0;
+    // Frames are stored with their tail bits, as given to dbpsk_encode_buffer().
+    for (idx = 0; idx < BENCH_DBPSK_BATCH_FRAMES; idx++) {
+        batch_in[(idx * BENCH_DBPSK_BUFFER_SIZE_BYTES) + bitstream_size_bytes] = BENCH_DBPSK_TAIL_BYTE;
+    }
+    for (frame = 0; frame < frame_count; frame += batch_frame_count) {
+        batch_frame_count = ((frame_count - frame) < BENCH_DBPSK_BATCH_FRAMES) ? (int) (frame_count - frame) : BENCH_DBPSK_BATCH_FRAMES;
+        batch_in[0] = (uint8_t) frame;
+        dbpsk_encode_batch(batch_in, BENCH_DBPSK_BUFFER_SIZE_BYTES, (bitstream_size_bytes * 8) + BENCH_DBPSK_TAIL_SIZE_BITS, batch_frame_count, batch_out, BENCH_DBPSK_BUFFER_SIZE_BYTES);
+        bench_sink ^= batch_out[bitstream_size_bytes];
+    }
+}
+
+/*******************************************************************/
+static void _encode_batches_soa(int bitstream_size_bytes, long frame_count) {
+    long frame = 0;
+    int batch_frame_count = 0;
+    int idx = 0;
+    // The encoding time does not depend on the payload.
+    for (idx = 0; idx < (BENCH_DBPSK_BATCH_FRAMES * BENCH_DBPSK_BATCH_SOA_WORDS); idx++) {
+        batch_soa_in[idx] = 0x5B5B5B5B5B5B5B5BULL * (uint64_t) (idx + 1);
+    }
+    for (frame = 0; frame < frame_count; frame += batch_frame_count) {
+        batch_frame_count = ((frame_count - frame) < BENCH_DBPSK_BATCH_FRAMES) ? (int) (frame_count - frame) : BENCH_DBPSK_BATCH_FRAMES;
+        batch_soa_in[0] = (uint64_t) frame;
+        dbpsk_encode_batch_soa(batch_soa_in, (bitstream_size_bytes * 8) + BENCH_DBPSK_TAIL_SIZE_BITS, batch_frame_count, batch_soa_out);
+        bench_sink ^= (uint8_t) batch_soa_out[0];
+    }
+}
+#endif
+
+/*******************************************************************/
+static void _encode_frames(bench_dbpsk_encoder_t encoder_type, uint8_t *data_in, int bitstream_size_bytes, long frame_count, uint8_t *data_out) {
+    dbpsk_encoder_t encoder;
+    long frame = 0;
+    for (frame = 0; frame < frame_count; frame++) {
+        // Change the payload so that successive frames are not identical.
+        data_in[0] = (uint8_t) frame;
+        if (encoder_type == BENCH_DBPSK_ENCODER_BUFFER) {
+            data_in[bitstream_size_bytes] = BENCH_DBPSK_TAIL_BYTE;
+            dbpsk_encode_buffer(data_in, (bitstream_size_bytes * 8) + BENCH_DBPSK_TAIL_SIZE_BITS, data_out);
+        } else {
+            dbpsk_encoder_init(&encoder);
+            dbpsk_encode_chunk(&encoder, data_in, bitstream_size_bytes, data_out);
+            dbpsk_encode_tail(&encoder, BENCH_DBPSK_TAIL_BYTE, BENCH_DBPSK_TAIL_SIZE_BITS, &(data_out[bitstream_size_bytes]));
+        }
+        bench_sink ^= data_out[bitstream_size_bytes];
+    }
+}
+
+/*******************************************************************/
+int main(int argc, char *argv[]) {
+    uint8_t data_in[BENCH_DBPSK_BUFFER_SIZE_BYTES];
+    uint8_t data_out[BENCH_DBPSK_BUFFER_SIZE_BYTES];
+    long frame_count = BENCH_DBPSK_FRAME_COUNT_DEFAULT;
+    int bitstream_size_bytes = 0;
+    int idx = 0;
+    bench_dbpsk_encoder_t encoder_type;
+    double start_ns = 0;
+    double frame_ns = 0;
+    double bit_count = 0;
+#ifdef BENCH_DBPSK_CYCLES
+    unsigned long long start_cycles = 0;
+    double bit_cycles = 0;
+#endif
+    if (argc > 1) {
+        frame_count = strtol(argv[1], NULL, 10);
+        if (frame_count <= 0) {
+            printf("Usage: %s [frame count]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    for (idx = 0; idx < BENCH_DBPSK_BUFFER_SIZE_BYTES; idx++) {
+        data_in[idx] = (uint8_t) ((idx * 0x9D) + 0x5B);
+    }
+    printf("%-14s %5s %12s %12s %14s\n", "encoder", "bytes", "ns/frame", "Mframes/s", "cycles/bit");
+    for (encoder_type = 0; encoder_type < BENCH_DBPSK_ENCODER_LAST; encoder_type++) {
+        for (bitstream_size_bytes = 1; bitstream_size_bytes <= BENCH_DBPSK_UL_BITSTREAM_SIZE_BYTES_MAX; bitstream_size_bytes++) {
+            bit_count = (double) frame_count * (double) ((bitstream_size_bytes * 8) + BENCH_DBPSK_TAIL_SIZE_BITS);
+            start_ns = _get_time_ns();
+#ifdef BENCH_DBPSK_CYCLES
+            start_cycles = __rdtsc();
+#endif
+#ifdef SMTC_DBPSK_BATCH
+            if (encoder_type == BENCH_DBPSK_ENCODER_BATCH) {
+                _encode_batches(bitstream_size_bytes, frame_count);
+            } else if (encoder_type == BENCH_DBPSK_ENCODER_BATCH_SOA) {
+                _encode_batches_soa(bitstream_size_bytes, frame_count);
+            } else {
+                _encode_frames(encoder_type, data_in, bitstream_size_bytes, frame_count, data_out);
+            }
+#else
+            _encode_frames(encoder_type, data_in, bitstream_size_bytes, frame_count, data_out);
+#endif
+#ifdef BENCH_DBPSK_CYCLES
+            // Time stamp counter cycles, at the nominal frequency of the CPU.
+            bit_cycles = (double) (__rdtsc() - start_cycles) / bit_count;
+#endif
+            frame_ns = (_get_time_ns() - start_ns) / (double) frame_count;
+#ifdef BENCH_DBPSK_CYCLES
+            printf("%-14s %5d %12.1f %12.3f %14.2f\n", BENCH_DBPSK_ENCODER_NAME[encoder_type], bitstream_size_bytes, frame_ns, 1e3 / frame_ns, bit_cycles);
+#else
+            printf("%-14s %5d %12.1f %12.3f %14s\n", BENCH_DBPSK_ENCODER_NAME[encoder_type], bitstream_size_bytes, frame_ns, 1e3 / frame_ns, "n/a");
+#endif
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,296 @@
+/*!*****************************************************************
+ * \file    test_dbpsk.c
+ * \brief   DBPSK encoder golden vector test against a bit level model.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2024, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "manuf/smtc_dbpsk.h"
+
+// Largest Sigfox uplink bitstream (SIGFOX_UL_BITSTREAM_SIZE_BYTES).
+#define TEST_DBPSK_UL_BITSTREAM_SIZE_BYTES_MAX 26
+// Lengths are tested up to the largest bitstream followed by its tail bits.
+#define TEST_DBPSK_LEN_IN_BITS_MAX ((TEST_DBPSK_UL_BITSTREAM_SIZE_BYTES_MAX * 8) + 2)
+// Room for the encoded frame and for the guard bytes checked after each call.
+#define TEST_DBPSK_BUFFER_SIZE_BYTES ((TEST_DBPSK_LEN_IN_BITS_MAX / 8) + 8)
+#define TEST_DBPSK_GUARD_BYTE 0xA5
+#define TEST_DBPSK_RANDOM_PAYLOADS 64
+// Tail appended by LR11XX_RF_API_send() after the bitstream.
+#define TEST_DBPSK_TAIL_BYTE 0x80
+#define TEST_DBPSK_TAIL_SIZE_BITS 2
+
+static unsigned int test_count = 0;
+static unsigned int test_failure_count = 0;
+static uint32_t random_state = 0x2545F491;
+
+/*******************************************************************/
+static uint8_t _random_byte(void) {
+    // Xorshift generator with a fixed seed, for reproducible payloads.
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return (uint8_t) (random_state >> 24);
+}
+
+/*******************************************************************/
+static void _check(int condition, const char *test_name, int len_in_bits, int payload_index) {
+    test_count++;
+    if (condition == 0) {
+        test_failure_count++;
+        printf("FAIL %s len_in_bits=%d payload=%d\n", test_name, len_in_bits, payload_index);
+    }
+}
+
+/*******************************************************************/
+static uint8_t _get_bit(const uint8_t *buffer, int bit_index) {
+    return (buffer[bit_index >> 3] >> (7 - (bit_index & 7))) & 0x01;
+}
+
+/*******************************************************************/
+static void _set_bit(uint8_t *buffer, int bit_index, uint8_t bit) {
+    buffer[bit_index >> 3] |= (uint8_t) (bit << (7 - (bit_index & 7)));
+}
+
+/*******************************************************************/
+static int _model_encode(const uint8_t *data_in, int len_in_bits, uint8_t *data_out) {
+    // Each output bit is the phase before the corresponding input bit, a 0 changes the phase.
+    // The phase after the last input bit is held during two bit-times.
+    uint8_t phase = 0;
+    int out_len_in_bits = 0;
+    int idx = 0;
+    memset(data_out, 0x00, TEST_DBPSK_BUFFER_SIZE_BYTES);
+    for (idx = 0; idx < len_in_bits; idx++) {
+        _set_bit(data_out, out_len_in_bits++, phase);
+        if (_get_bit(data_in, idx) == 0) {
+            phase ^= 0x01;
+        }
+    }
+    _set_bit(data_out, out_len_in_bits++, phase);
+    _set_bit(data_out, out_len_in_bits++, phase);
+    return out_len_in_bits;
+}
+
+/*******************************************************************/
+static void _fill_payload(uint8_t *data, int payload_index) {
+    int idx = 0;
+    for (idx = 0; idx < TEST_DBPSK_BUFFER_SIZE_BYTES; idx++) {
+        switch (payload_index) {
+        case 0:
+            data[idx] = 0x00;
+            break;
+        case 1:
+            data[idx] = 0xFF;
+            break;
+        case 2:
+            data[idx] = 0xAA;
+            break;
+        default:
+            data[idx] = _random_byte();
+            break;
+        }
+    }
+}
+
+/*******************************************************************/
+static int _guard_intact(const uint8_t *buffer, int from_byte) {
+    int idx = 0;
+    for (idx = from_byte; idx < TEST_DBPSK_BUFFER_SIZE_BYTES; idx++) {
+        if (buffer[idx] != TEST_DBPSK_GUARD_BYTE) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*******************************************************************/
+static void _test_model(void) {
+    // Hand computed vectors, to make sure that the model itself is right.
+    static const uint8_t GOLDEN_IN[4] = { 0x00, 0xFF, 0xAA, 0x7F };
+    static const uint8_t GOLDEN_OUT[4][2] = { { 0x55, 0x00 }, { 0x00, 0x00 }, { 0x33, 0x00 }, { 0x7F, 0xC0 } };
+    uint8_t model_out[TEST_DBPSK_BUFFER_SIZE_BYTES];
+    int idx = 0;
+    for (idx = 0; idx < 4; idx++) {
+        _check(_model_encode(&(GOLDEN_IN[idx]), 8, model_out) == 10, "model length", 8, idx);
+        _check(memcmp(model_out, GOLDEN_OUT[idx], 2) == 0, "model", 8, idx);
+    }
+}
+
+/*******************************************************************/
+static void _test_pld_len(void) {
+    uint8_t data_in[TEST_DBPSK_BUFFER_SIZE_BYTES] = { 0 };
+    uint8_t model_out[TEST_DBPSK_BUFFER_SIZE_BYTES];
+    int len_in_bits = 0;
+    int model_len_in_bits = 0;
+    for (len_in_bits = 1; len_in_bits <= TEST_DBPSK_LEN_IN_BITS_MAX; len_in_bits++) {
+        model_len_in_bits = _model_encode(data_in, len_in_bits, model_out);
+        _check(dbpsk_get_pld_len_in_bits(len_in_bits) == model_len_in_bits, "dbpsk_get_pld_len_in_bits", len_in_bits, 0);
+        _check(dbpsk_get_pld_len_in_bytes(len_in_bits) == ((model_len_in_bits + 7) / 8), "dbpsk_get_pld_len_in_bytes", len_in_bits, 0);
+    }
+}
+
+/*******************************************************************/
+static void _test_encode_buffer(void) {
+    uint8_t data_in[TEST_DBPSK_BUFFER_SIZE_BYTES];
+    uint8_t data_out[TEST_DBPSK_BUFFER_SIZE_BYTES];
+    uint8_t model_out[TEST_DBPSK_BUFFER_SIZE_BYTES];
+    int len_in_bits = 0;
+    int len_in_bytes = 0;
+    int payload_index = 0;
+    for (len_in_bits = 1; len_in_bits <= TEST_DBPSK_LEN_IN_BITS_MAX; len_in_bits++) {
+        len_in_bytes = dbpsk_get_pld_len_in_bytes(len_in_bits);
+        for (payload_index = 0; payload_index < TEST_DBPSK_RANDOM_PAYLOADS; payload_index++) {
+            _fill_payload(data_in, payload_index);
+            _model_encode(data_in, len_in_bits, model_out);
+            // Separate output buffer.
+            memset(data_out, TEST_DBPSK_GUARD_BYTE, sizeof(data_out));
+            dbpsk_encode_buffer(data_in, len_in_bits, data_out);
+            _check(memcmp(data_out, model_out, len_in_bytes) == 0, "dbpsk_encode_buffer", len_in_bits, payload_index);
+            _check(_guard_intact(data_out, len_in_bytes), "dbpsk_encode_buffer overflow", len_in_bits, payload_index);
+            // In place (data_in == data_out).
+            memset(data_out, TEST_DBPSK_GUARD_BYTE, sizeof(data_out));
+            memcpy(data_out, data_in, (len_in_bits + 7) / 8);
+            dbpsk_encode_buffer(data_out, len_in_bits, data_out);
+            _check(memcmp(data_out, model_out, len_in_bytes) == 0, "dbpsk_encode_buffer in place", len_in_bits, payload_index);
+            _check(_guard_intact(data_out, len_in_bytes), "dbpsk_encode_buffer in place overflow", len_in_bits, payload_index);
+        }
+    }
+}
+
+/*******************************************************************/
+static void _test_encode_chunk_tail(void) {
+    uint8_t data_in[TEST_DBPSK_BUFFER_SIZE_BYTES];
+    uint8_t data_out[TEST_DBPSK_BUFFER_SIZE_BYTES];
+    uint8_t model_out[TEST_DBPSK_BUFFER_SIZE_BYTES];
+    dbpsk_encoder_t encoder;
+    int len_in_bits = 0;
+    int len_in_bytes = 0;
+    int split_in_bytes = 0;
+    int tail_len_in_bits = 0;
+    int payload_index = 0;
+    for (len_in_bits = 1; len_in_bits <= TEST_DBPSK_LEN_IN_BITS_MAX; len_in_bits++) {
+        len_in_bytes = dbpsk_get_pld_len_in_bytes(len_in_bits);
+        tail_len_in_bits = len_in_bits & 7;
+        for (payload_index = 0; payload_index < TEST_DBPSK_RANDOM_PAYLOADS; payload_index++) {
+            _fill_payload(data_in, payload_index);
+            _model_encode(data_in, len_in_bits, model_out);
+            // Full bytes in two chunks, split at a random position, then the remaining bits.
+            split_in_bytes = (len_in_bits >> 3) == 0 ? 0 : (_random_byte() % ((len_in_bits >> 3) + 1));
+            memset(data_out, TEST_DBPSK_GUARD_BYTE, sizeof(data_out));
+            dbpsk_encoder_init(&encoder);
+            dbpsk_encode_chunk(&encoder, data_in, split_in_bytes, data_out);
+            dbpsk_encode_chunk(&encoder, &(data_in[split_in_bytes]), (len_in_bits >> 3) - split_in_bytes, &(data_out[split_in_bytes]));
+            dbpsk_encode_tail(&encoder, data_in[len_in_bits >> 3], tail_len_in_bits, &(data_out[len_in_bits >> 3]));
+            _check(memcmp(data_out, model_out, len_in_bytes) == 0, "dbpsk_encode_chunk/tail", len_in_bits, payload_index);
+            _check(_guard_intact(data_out, len_in_bytes), "dbpsk_encode_chunk/tail overflow", len_in_bits, payload_index);
+            // In place.
+            memset(data_out, TEST_DBPSK_GUARD_BYTE, sizeof(data_out));
+            memcpy(data_out, data_in, (len_in_bits + 7) / 8);
+            dbpsk_encoder_init(&encoder);
+            dbpsk_encode_chunk(&encoder, data_out, len_in_bits >> 3, data_out);
+            dbpsk_encode_tail(&encoder, data_out[len_in_bits >> 3], tail_len_in_bits, &(data_out[len_in_bits >> 3]));
+            _check(memcmp(data_out, model_out, len_in_bytes) == 0, "dbpsk_encode_chunk/tail in place", len_in_bits, payload_index);
+        }
+    }
+}
+
+/*******************************************************************/
+static void _test_encode_ul_frame(void) {
+    uint8_t bitstream[TEST_DBPSK_BUFFER_SIZE_BYTES];
+    uint8_t data_out[TEST_DBPSK_BUFFER_SIZE_BYTES];
+    uint8_t model_in[TEST_DBPSK_BUFFER_SIZE_BYTES];
+    uint8_t model_out[TEST_DBPSK_BUFFER_SIZE_BYTES];
+    dbpsk_encoder_t encoder;
+    int bitstream_size_bytes = 0;
+    int len_in_bits = 0;
+    int payload_index = 0;
+    // Every uplink bitstream size, encoded as LR11XX_RF_API_send() does: bitstream followed by the tail bits.
+    for (bitstream_size_bytes = 1; bitstream_size_bytes <= TEST_DBPSK_UL_BITSTREAM_SIZE_BYTES_MAX; bitstream_size_bytes++) {
+        len_in_bits = (bitstream_size_bytes * 8) + TEST_DBPSK_TAIL_SIZE_BITS;
+        for (payload_index = 0; payload_index < TEST_DBPSK_RANDOM_PAYLOADS; payload_index++) {
+            _fill_payload(bitstream, payload_index);
+            memcpy(model_in, bitstream, bitstream_size_bytes);
+            model_in[bitstream_size_bytes] = TEST_DBPSK_TAIL_BYTE;
+            _model_encode(model_in, len_in_bits, model_out);
+            memset(data_out, TEST_DBPSK_GUARD_BYTE, sizeof(data_out));
+            dbpsk_encoder_init(&encoder);
+            dbpsk_encode_chunk(&encoder, bitstream, bitstream_size_bytes, data_out);
+            dbpsk_encode_tail(&encoder, TEST_DBPSK_TAIL_BYTE, TEST_DBPSK_TAIL_SIZE_BITS, &(data_out[bitstream_size_bytes]));
+            _check(memcmp(data_out, model_out, dbpsk_get_pld_len_in_bytes(len_in_bits)) == 0, "uplink frame", len_in_bits, payload_index);
+            _check(_guard_intact(data_out, dbpsk_get_pld_len_in_bytes(len_in_bits)), "uplink frame overflow", len_in_bits, payload_index);
+        }
+    }
+}
+
+/*******************************************************************/
+static void _test_decode_buffer(void) {
+    uint8_t data_in[TEST_DBPSK_BUFFER_SIZE_BYTES];
+    uint8_t data_out[TEST_DBPSK_BUFFER_SIZE_BYTES];
+    uint8_t decoded[TEST_DBPSK_BUFFER_SIZE_BYTES];
+    int len_in_bits = 0;
+    int payload_index = 0;
+    int idx = 0;
+    int equal = 0;
+    for (len_in_bits = 1; len_in_bits <= TEST_DBPSK_LEN_IN_BITS_MAX; len_in_bits++) {
+        for (payload_index = 0; payload_index < TEST_DBPSK_RANDOM_PAYLOADS; payload_index++) {
+            _fill_payload(data_in, payload_index);
+            _model_encode(data_in, len_in_bits, data_out);
+            memset(decoded, 0x00, sizeof(decoded));
+            dbpsk_decode_buffer(data_out, len_in_bits, decoded);
+            equal = 1;
+            for (idx = 0; idx < len_in_bits; idx++) {
+                if (_get_bit(decoded, idx) != _get_bit(data_in, idx)) {
+                    equal = 0;
+                }
+            }
+            _check(equal, "dbpsk_decode_buffer", len_in_bits, payload_index);
+            // In place.
+            dbpsk_decode_buffer(data_out, len_in_bits, data_out);
+            _check(memcmp(data_out, decoded, (len_in_bits + 7) / 8) == 0, "dbpsk_decode_buffer in place", len_in_bits, payload_index);
+        }
+    }
+}
+
+/*******************************************************************/
+int main(void) {
+    _test_model();
+    _test_pld_len();
+    _test_encode_buffer();
+    _test_encode_chunk_tail();
+    _test_encode_ul_frame();
+    _test_decode_buffer();
+    printf("%u checks, %u failures\n", test_count, test_failure_count);
+    return (test_failure_count == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
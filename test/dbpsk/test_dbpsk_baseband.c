@@ -0,0 +1,204 @@
+/*!*****************************************************************
+ * \file    test_dbpsk_baseband.c
+ * \brief   DBPSK I/Q baseband generator and demodulator test.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2024, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "manuf/lr11xx_dbpsk_baseband.h"
+#include "manuf/smtc_dbpsk.h"
+#include "lr11xx_radio_types.h"
+
+// Largest Sigfox uplink bitstream (SIGFOX_UL_BITSTREAM_SIZE_BYTES).
+#define TEST_BASEBAND_UL_BITSTREAM_SIZE_BYTES_MAX 26
+#define TEST_BASEBAND_BUFFER_SIZE_BYTES (TEST_BASEBAND_UL_BITSTREAM_SIZE_BYTES_MAX + 2)
+// Tail appended by LR11XX_RF_API_send() after the bitstream.
+#define TEST_BASEBAND_TAIL_BYTE 0x80
+#define TEST_BASEBAND_TAIL_SIZE_BITS 2
+#define TEST_BASEBAND_SAMPLES_MAX ((((TEST_BASEBAND_BUFFER_SIZE_BYTES * 8) + 2) * LR11XX_DBPSK_BASEBAND_OVERSAMPLING_MAX) + (2 * LR11XX_DBPSK_BASEBAND_RAMP_LEN_MAX))
+// Block size of the streaming generation, not a divider of the oversampling ratios.
+#define TEST_BASEBAND_BLOCK_SIZE 7
+#define TEST_BASEBAND_PAYLOADS 8
+// Peak amplitude of the uniform noise added before demodulation.
+#define TEST_BASEBAND_NOISE 0.4f
+
+typedef struct {
+    uint32_t bit_rate_bps;
+    uint16_t ramp_up_delay_us;
+    uint16_t ramp_down_delay_us;
+} test_baseband_bit_rate_t;
+
+static const test_baseband_bit_rate_t TEST_BASEBAND_BIT_RATES[] = {
+    { 100, LR11XX_RADIO_SIGFOX_DBPSK_RAMP_UP_TIME_100_BPS, LR11XX_RADIO_SIGFOX_DBPSK_RAMP_DOWN_TIME_100_BPS },
+    { 600, LR11XX_RADIO_SIGFOX_DBPSK_RAMP_UP_TIME_600_BPS, LR11XX_RADIO_SIGFOX_DBPSK_RAMP_DOWN_TIME_600_BPS },
+};
+static const uint16_t TEST_BASEBAND_OVERSAMPLING[] = { 4, 8, 16, 64 };
+
+static unsigned int test_count = 0;
+static unsigned int test_failure_count = 0;
+static uint32_t random_state = 0x2545F491;
+static LR11XX_DBPSK_BASEBAND_iq_t frame_iq[TEST_BASEBAND_SAMPLES_MAX];
+static LR11XX_DBPSK_BASEBAND_iq_t block_iq[TEST_BASEBAND_SAMPLES_MAX];
+
+/*******************************************************************/
+static uint32_t _random(void) {
+    // Xorshift generator with a fixed seed, for reproducible payloads and noise.
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+/*******************************************************************/
+static float _random_noise(void) {
+    return TEST_BASEBAND_NOISE * ((((float) (_random() >> 8)) / 8388608.0f) - 1.0f);
+}
+
+/*******************************************************************/
+static void _check(int condition, const char *test_name, uint32_t bit_rate_bps, uint16_t oversampling, int size_bytes) {
+    test_count++;
+    if (condition == 0) {
+        test_failure_count++;
+        printf("FAIL %s bit_rate=%u oversampling=%u size_bytes=%d\n", test_name, (unsigned int) bit_rate_bps, (unsigned int) oversampling, size_bytes);
+    }
+}
+
+/*******************************************************************/
+static float _magnitude(const LR11XX_DBPSK_BASEBAND_iq_t *iq) {
+    return sqrtf((iq->i * iq->i) + (iq->q * iq->q));
+}
+
+/*******************************************************************/
+static void _build_frame(int size_bytes, uint8_t *bitstream, uint8_t *buffer, lr11xx_radio_pkt_params_bpsk_t *pkt_params, const test_baseband_bit_rate_t *bit_rate) {
+    // Same buffer and packet parameters as LR11XX_RF_API_send().
+    dbpsk_encoder_t encoder;
+    int idx = 0;
+    for (idx = 0; idx < size_bytes; idx++) {
+        bitstream[idx] = (uint8_t) (_random() >> 24);
+    }
+    dbpsk_encoder_init(&encoder);
+    dbpsk_encode_chunk(&encoder, bitstream, size_bytes, buffer);
+    dbpsk_encode_tail(&encoder, TEST_BASEBAND_TAIL_BYTE, TEST_BASEBAND_TAIL_SIZE_BITS, &(buffer[size_bytes]));
+    pkt_params->pld_len_in_bits = (uint16_t) dbpsk_get_pld_len_in_bits(size_bytes * 8);
+    pkt_params->pld_len_in_bytes = (uint8_t) dbpsk_get_pld_len_in_bytes(size_bytes * 8);
+    pkt_params->ramp_up_delay = bit_rate->ramp_up_delay_us;
+    pkt_params->ramp_down_delay = bit_rate->ramp_down_delay_us;
+}
+
+/*******************************************************************/
+static void _test_parameters(void) {
+    LR11XX_DBPSK_BASEBAND_t baseband;
+    lr11xx_radio_pkt_params_bpsk_t pkt_params = { 2, 0, 0, 17 };
+    _check(LR11XX_DBPSK_BASEBAND_init(&baseband, 0, 8, 0) == LR11XX_DBPSK_BASEBAND_ERROR_BIT_RATE, "init bit rate", 0, 8, 0);
+    _check(LR11XX_DBPSK_BASEBAND_init(&baseband, 100, LR11XX_DBPSK_BASEBAND_OVERSAMPLING_MIN - 1, 0) == LR11XX_DBPSK_BASEBAND_ERROR_OVERSAMPLING, "init oversampling", 100, LR11XX_DBPSK_BASEBAND_OVERSAMPLING_MIN - 1, 0);
+    _check(LR11XX_DBPSK_BASEBAND_init(&baseband, 100, LR11XX_DBPSK_BASEBAND_OVERSAMPLING_MAX + 1, 0) == LR11XX_DBPSK_BASEBAND_ERROR_OVERSAMPLING, "init oversampling", 100, LR11XX_DBPSK_BASEBAND_OVERSAMPLING_MAX + 1, 0);
+    _check(LR11XX_DBPSK_BASEBAND_init(&baseband, 100, 8, 0) == LR11XX_DBPSK_BASEBAND_SUCCESS, "init", 100, 8, 0);
+    // More bits than the buffer size.
+    _check(LR11XX_DBPSK_BASEBAND_set_pkt_params(&baseband, &pkt_params) == LR11XX_DBPSK_BASEBAND_ERROR_PKT_PARAMS, "pkt params length", 100, 8, 2);
+    // Ramp longer than two bits.
+    pkt_params.pld_len_in_bits = 16;
+    pkt_params.ramp_up_delay = 25000;
+    _check(LR11XX_DBPSK_BASEBAND_set_pkt_params(&baseband, &pkt_params) == LR11XX_DBPSK_BASEBAND_ERROR_PKT_PARAMS, "pkt params ramp", 100, 8, 2);
+}
+
+/*******************************************************************/
+static void _test_frame(const test_baseband_bit_rate_t *bit_rate, uint16_t oversampling, int size_bytes) {
+    LR11XX_DBPSK_BASEBAND_t baseband;
+    lr11xx_radio_pkt_params_bpsk_t pkt_params;
+    uint8_t bitstream[TEST_BASEBAND_BUFFER_SIZE_BYTES];
+    uint8_t buffer[TEST_BASEBAND_BUFFER_SIZE_BYTES];
+    uint8_t decoded[TEST_BASEBAND_BUFFER_SIZE_BYTES];
+    uint32_t ramp_up_len = 0;
+    uint32_t ramp_down_len = 0;
+    uint32_t len_in_samples = 0;
+    uint32_t sample = 0;
+    uint32_t idx = 0;
+    int full_envelope = 1;
+    float carrier_phase_rad = (float) (_random() % 628) / 100.0f;
+    _build_frame(size_bytes, bitstream, buffer, &pkt_params, bit_rate);
+    _check(LR11XX_DBPSK_BASEBAND_init(&baseband, bit_rate->bit_rate_bps, oversampling, carrier_phase_rad) == LR11XX_DBPSK_BASEBAND_SUCCESS, "init", bit_rate->bit_rate_bps, oversampling, size_bytes);
+    _check(LR11XX_DBPSK_BASEBAND_set_pkt_params(&baseband, &pkt_params) == LR11XX_DBPSK_BASEBAND_SUCCESS, "pkt params", bit_rate->bit_rate_bps, oversampling, size_bytes);
+    // Ramp durations converted to samples.
+    ramp_up_len = (uint32_t) ((((uint64_t) bit_rate->ramp_up_delay_us * bit_rate->bit_rate_bps * oversampling) + 500000) / 1000000);
+    ramp_down_len = (uint32_t) ((((uint64_t) bit_rate->ramp_down_delay_us * bit_rate->bit_rate_bps * oversampling) + 500000) / 1000000);
+    len_in_samples = LR11XX_DBPSK_BASEBAND_get_len_in_samples(&baseband);
+    _check(len_in_samples == (ramp_up_len + ((uint32_t) pkt_params.pld_len_in_bits * oversampling) + ramp_down_len), "length", bit_rate->bit_rate_bps, oversampling, size_bytes);
+    // Whole frame and block by block generation.
+    _check(LR11XX_DBPSK_BASEBAND_modulate(&baseband, buffer, 0, frame_iq, TEST_BASEBAND_SAMPLES_MAX) == len_in_samples, "modulate", bit_rate->bit_rate_bps, oversampling, size_bytes);
+    for (sample = 0; sample < len_in_samples; sample += TEST_BASEBAND_BLOCK_SIZE) {
+        LR11XX_DBPSK_BASEBAND_modulate(&baseband, buffer, sample, &(block_iq[sample]), TEST_BASEBAND_BLOCK_SIZE);
+    }
+    _check(memcmp(frame_iq, block_iq, len_in_samples * sizeof(LR11XX_DBPSK_BASEBAND_iq_t)) == 0, "modulate blocks", bit_rate->bit_rate_bps, oversampling, size_bytes);
+    _check(LR11XX_DBPSK_BASEBAND_modulate(&baseband, buffer, len_in_samples, block_iq, 1) == 0, "modulate end", bit_rate->bit_rate_bps, oversampling, size_bytes);
+    // Ramps from and to zero, constant envelope between the phase changes.
+    _check(_magnitude(&(frame_iq[0])) < 0.5f, "ramp up start", bit_rate->bit_rate_bps, oversampling, size_bytes);
+    _check(_magnitude(&(frame_iq[len_in_samples - 1])) < 0.5f, "ramp down end", bit_rate->bit_rate_bps, oversampling, size_bytes);
+    for (idx = 0; idx < oversampling; idx++) {
+        if (fabsf(_magnitude(&(frame_iq[ramp_up_len + idx])) - 1.0f) > 1e-3f) {
+            full_envelope = 0;
+        }
+    }
+    _check(full_envelope, "first bit envelope", bit_rate->bit_rate_bps, oversampling, size_bytes);
+    // Demodulation with noise.
+    for (idx = 0; idx < len_in_samples; idx++) {
+        frame_iq[idx].i += _random_noise();
+        frame_iq[idx].q += _random_noise();
+    }
+    memset(decoded, 0x00, sizeof(decoded));
+    LR11XX_DBPSK_BASEBAND_demodulate(&baseband, frame_iq, decoded);
+    _check(memcmp(decoded, bitstream, (size_t) size_bytes) == 0, "demodulate", bit_rate->bit_rate_bps, oversampling, size_bytes);
+}
+
+/*******************************************************************/
+int main(void) {
+    int size_bytes = 0;
+    size_t bit_rate_index = 0;
+    size_t oversampling_index = 0;
+    int payload_index = 0;
+    _test_parameters();
+    for (bit_rate_index = 0; bit_rate_index < (sizeof(TEST_BASEBAND_BIT_RATES) / sizeof(TEST_BASEBAND_BIT_RATES[0])); bit_rate_index++) {
+        for (oversampling_index = 0; oversampling_index < (sizeof(TEST_BASEBAND_OVERSAMPLING) / sizeof(TEST_BASEBAND_OVERSAMPLING[0])); oversampling_index++) {
+            for (size_bytes = 1; size_bytes <= TEST_BASEBAND_UL_BITSTREAM_SIZE_BYTES_MAX; size_bytes++) {
+                for (payload_index = 0; payload_index < TEST_BASEBAND_PAYLOADS; payload_index++) {
+                    _test_frame(&(TEST_BASEBAND_BIT_RATES[bit_rate_index]), TEST_BASEBAND_OVERSAMPLING[oversampling_index], size_bytes);
+                }
+            }
+        }
+    }
+    printf("%u checks, %u failures\n", test_count, test_failure_count);
+    return (test_failure_count == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
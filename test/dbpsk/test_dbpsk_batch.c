@@ -0,0 +1,186 @@
+/*!*****************************************************************
+ * \file    test_dbpsk_batch.c
+ * \brief   DBPSK batch encoder equivalence test against dbpsk_encode_buffer.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2024, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "manuf/smtc_dbpsk.h"
+
+// Largest Sigfox uplink bitstream (SIGFOX_UL_BITSTREAM_SIZE_BYTES).
+#define TEST_BATCH_UL_BITSTREAM_SIZE_BYTES_MAX 26
+// Lengths are tested up to the largest bitstream followed by its tail bits.
+#define TEST_BATCH_LEN_IN_BITS_MAX ((TEST_BATCH_UL_BITSTREAM_SIZE_BYTES_MAX * 8) + 2)
+#define TEST_BATCH_FRAME_SIZE_BYTES_MAX ((TEST_BATCH_LEN_IN_BITS_MAX / 8) + 2)
+// Output frames are spaced by padding bytes which must not be written.
+#define TEST_BATCH_PADDING_BYTES 3
+#define TEST_BATCH_STRIDE_MAX (TEST_BATCH_FRAME_SIZE_BYTES_MAX + TEST_BATCH_PADDING_BYTES)
+#define TEST_BATCH_FRAMES_MAX 33
+#define TEST_BATCH_GUARD_BYTE 0xA5
+
+// Structure of arrays arenas, in 64-bit words per frame.
+#define TEST_BATCH_SOA_WORDS_MAX ((TEST_BATCH_LEN_IN_BITS_MAX + 65) >> 6)
+
+static const int TEST_BATCH_FRAME_COUNT[] = { 0, 1, 2, 7, TEST_BATCH_FRAMES_MAX };
+
+static unsigned int test_count = 0;
+static unsigned int test_failure_count = 0;
+static uint32_t random_state = 0x2545F491;
+static uint8_t batch_in[TEST_BATCH_FRAMES_MAX * TEST_BATCH_STRIDE_MAX];
+static uint8_t batch_out[(TEST_BATCH_FRAMES_MAX + 1) * TEST_BATCH_STRIDE_MAX];
+static uint64_t batch_soa_in[TEST_BATCH_FRAMES_MAX * TEST_BATCH_SOA_WORDS_MAX];
+static uint64_t batch_soa_out[(TEST_BATCH_FRAMES_MAX + 1) * TEST_BATCH_SOA_WORDS_MAX];
+
+/*******************************************************************/
+static uint8_t _random_byte(void) {
+    // Xorshift generator with a fixed seed, for reproducible payloads.
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return (uint8_t) (random_state >> 24);
+}
+
+/*******************************************************************/
+static void _check(int condition, const char *test_name, int len_in_bits, int frame_count, int frame) {
+    test_count++;
+    if (condition == 0) {
+        test_failure_count++;
+        printf("FAIL %s len_in_bits=%d frame_count=%d frame=%d\n", test_name, len_in_bits, frame_count, frame);
+    }
+}
+
+/*******************************************************************/
+static void _test_batch(int len_in_bits, int data_in_stride, int data_out_stride, int frame_count) {
+    uint8_t reference[TEST_BATCH_FRAME_SIZE_BYTES_MAX + 1];
+    int out_len_in_bytes = dbpsk_get_pld_len_in_bytes(len_in_bits);
+    int frame = 0;
+    int idx = 0;
+    int guard_intact = 1;
+    for (idx = 0; idx < (int) sizeof(batch_in); idx++) {
+        batch_in[idx] = _random_byte();
+    }
+    memset(batch_out, TEST_BATCH_GUARD_BYTE, sizeof(batch_out));
+    dbpsk_encode_batch(batch_in, data_in_stride, len_in_bits, frame_count, batch_out, data_out_stride);
+    for (frame = 0; frame < frame_count; frame++) {
+        // dbpsk_encode_buffer() reads the byte following the last full byte.
+        memset(reference, 0x00, sizeof(reference));
+        memcpy(reference, &(batch_in[frame * data_in_stride]), (size_t) ((len_in_bits + 7) >> 3));
+        dbpsk_encode_buffer(reference, len_in_bits, reference);
+        _check(memcmp(&(batch_out[frame * data_out_stride]), reference, (size_t) out_len_in_bytes) == 0, "dbpsk_encode_batch", len_in_bits, frame_count, frame);
+    }
+    // Padding between the frames and space after the last frame.
+    for (frame = 0; frame <= frame_count; frame++) {
+        for (idx = ((frame < frame_count) ? out_len_in_bytes : 0); idx < data_out_stride; idx++) {
+            if (batch_out[(frame * data_out_stride) + idx] != TEST_BATCH_GUARD_BYTE) {
+                guard_intact = 0;
+            }
+        }
+    }
+    _check(guard_intact, "dbpsk_encode_batch overflow", len_in_bits, frame_count, frame_count);
+}
+
+/*******************************************************************/
+static void _test_batch_soa(int len_in_bits, int frame_count) {
+    uint8_t frame_in[TEST_BATCH_SOA_WORDS_MAX * 8];
+    uint8_t frame_out[TEST_BATCH_SOA_WORDS_MAX * 8];
+    uint8_t reference[TEST_BATCH_SOA_WORDS_MAX * 8];
+    int in_len_in_words = (len_in_bits + 63) >> 6;
+    int out_len_in_words = dbpsk_get_batch_soa_len_in_words(len_in_bits);
+    int out_len_in_bytes = dbpsk_get_pld_len_in_bytes(len_in_bits);
+    int frame = 0;
+    int idx = 0;
+    int byte_idx = 0;
+    int guard_intact = 1;
+    for (idx = 0; idx < (int) (sizeof(batch_soa_in) / sizeof(batch_soa_in[0])); idx++) {
+        batch_soa_in[idx] = 0;
+        for (byte_idx = 0; byte_idx < 8; byte_idx++) {
+            batch_soa_in[idx] = (batch_soa_in[idx] << 8) | _random_byte();
+        }
+    }
+    memset(batch_soa_out, TEST_BATCH_GUARD_BYTE, sizeof(batch_soa_out));
+    dbpsk_encode_batch_soa(batch_soa_in, len_in_bits, frame_count, batch_soa_out);
+    for (frame = 0; frame < frame_count; frame++) {
+        // Frame bytes in transmission order, from the words of the frame.
+        for (idx = 0; idx < (in_len_in_words * 8); idx++) {
+            frame_in[idx] = (uint8_t) (batch_soa_in[((idx >> 3) * frame_count) + frame] >> (56 - ((idx & 7) * 8)));
+        }
+        for (idx = 0; idx < (out_len_in_words * 8); idx++) {
+            frame_out[idx] = (uint8_t) (batch_soa_out[((idx >> 3) * frame_count) + frame] >> (56 - ((idx & 7) * 8)));
+        }
+        memset(reference, 0x00, sizeof(reference));
+        memcpy(reference, frame_in, (size_t) ((len_in_bits + 7) >> 3));
+        // Bits after the end of the frame are ignored.
+        if ((len_in_bits & 7) != 0) {
+            reference[len_in_bits >> 3] &= (uint8_t) (0xFF << (8 - (len_in_bits & 7)));
+        }
+        dbpsk_encode_buffer(reference, len_in_bits, reference);
+        // Output bytes after the encoded frame are zero.
+        memset(&(reference[out_len_in_bytes]), 0x00, sizeof(reference) - (size_t) out_len_in_bytes);
+        _check(memcmp(frame_out, reference, (size_t) (out_len_in_words * 8)) == 0, "dbpsk_encode_batch_soa", len_in_bits, frame_count, frame);
+    }
+    // Space after the output arena.
+    for (idx = (out_len_in_words * frame_count); idx < (int) (sizeof(batch_soa_out) / sizeof(batch_soa_out[0])); idx++) {
+        if (batch_soa_out[idx] != (UINT64_MAX / 0xFF) * TEST_BATCH_GUARD_BYTE) {
+            guard_intact = 0;
+        }
+    }
+    _check(guard_intact, "dbpsk_encode_batch_soa overflow", len_in_bits, frame_count, frame_count);
+}
+
+/*******************************************************************/
+int main(void) {
+    int len_in_bits = 0;
+    int count_index = 0;
+    int data_in_stride = 0;
+    int data_out_stride = 0;
+    for (len_in_bits = 1; len_in_bits <= TEST_BATCH_LEN_IN_BITS_MAX; len_in_bits++) {
+        for (count_index = 0; count_index < (int) (sizeof(TEST_BATCH_FRAME_COUNT) / sizeof(TEST_BATCH_FRAME_COUNT[0])); count_index++) {
+            // Smallest strides, then strides with padding between the frames.
+            data_in_stride = (len_in_bits + 7) >> 3;
+            data_out_stride = dbpsk_get_pld_len_in_bytes(len_in_bits);
+            _test_batch(len_in_bits, data_in_stride, data_out_stride, TEST_BATCH_FRAME_COUNT[count_index]);
+            _test_batch(len_in_bits, data_in_stride + TEST_BATCH_PADDING_BYTES, data_out_stride + TEST_BATCH_PADDING_BYTES, TEST_BATCH_FRAME_COUNT[count_index]);
+            _test_batch_soa(len_in_bits, TEST_BATCH_FRAME_COUNT[count_index]);
+        }
+    }
+#ifdef SMTC_DBPSK_BATCH_SCALAR
+    printf("scalar: ");
+#else
+    printf("words: ");
+#endif
+    printf("%u checks, %u failures\n", test_count, test_failure_count);
+    return (test_failure_count == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,190 @@
+/*!*****************************************************************
+ * \file    test_lr11xx_rf_api_coex.c
+ * \brief   RF API coexistence test: the chip is not accessed while it is owned by the external user.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2024, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sigfox_types.h"
+#include "manuf/rf_api.h"
+#include "manuf/lr11xx_rf_api.h"
+#include "board/lr11xx_hw_api.h"
+#include "lr11xx_hal.h"
+
+static unsigned int test_count = 0;
+static unsigned int test_failure_count = 0;
+// Chip and bus accesses seen by the mocked HAL and board.
+static unsigned int spi_transfer_count = 0;
+static unsigned int bus_acquire_count = 0;
+static unsigned int coex_granted_count = 0;
+
+/*** Mocked LR11XX HAL ***/
+
+/*******************************************************************/
+lr11xx_hal_status_t lr11xx_hal_reset(const void *context) {
+    SIGFOX_UNUSED(context);
+    spi_transfer_count++;
+    return LR11XX_HAL_STATUS_OK;
+}
+
+/*******************************************************************/
+lr11xx_hal_status_t lr11xx_hal_wakeup(const void *context) {
+    SIGFOX_UNUSED(context);
+    spi_transfer_count++;
+    return LR11XX_HAL_STATUS_OK;
+}
+
+/*******************************************************************/
+lr11xx_hal_status_t lr11xx_hal_read(const void *context, const uint8_t *cbuffer, const uint16_t cbuffer_length, uint8_t *rbuffer, const uint16_t rbuffer_length) {
+    SIGFOX_UNUSED(context);
+    SIGFOX_UNUSED(cbuffer);
+    SIGFOX_UNUSED(cbuffer_length);
+    if (rbuffer != SIGFOX_NULL) {
+        memset(rbuffer, 0x00, rbuffer_length);
+    }
+    spi_transfer_count++;
+    return LR11XX_HAL_STATUS_OK;
+}
+
+/*******************************************************************/
+lr11xx_hal_status_t lr11xx_hal_write(const void *context, const uint8_t *cbuffer, const uint16_t cbuffer_length, const uint8_t *cdata, const uint16_t cdata_length) {
+    SIGFOX_UNUSED(context);
+    SIGFOX_UNUSED(cbuffer);
+    SIGFOX_UNUSED(cbuffer_length);
+    SIGFOX_UNUSED(cdata);
+    SIGFOX_UNUSED(cdata_length);
+    spi_transfer_count++;
+    return LR11XX_HAL_STATUS_OK;
+}
+
+/*******************************************************************/
+lr11xx_hal_status_t lr11xx_hal_direct_read(const void *context, uint8_t *buffer, const uint16_t length) {
+    SIGFOX_UNUSED(context);
+    if (buffer != SIGFOX_NULL) {
+        memset(buffer, 0x00, length);
+    }
+    spi_transfer_count++;
+    return LR11XX_HAL_STATUS_OK;
+}
+
+/*** Mocked LR11XX HW API (the other functions are the weak templates) ***/
+
+/*******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_open(LR11XX_HW_API_config_t *hw_api_config) {
+    SIGFOX_UNUSED(hw_api_config);
+    return LR11XX_HW_API_SUCCESS;
+}
+
+/*******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_close(void) {
+    return LR11XX_HW_API_SUCCESS;
+}
+
+/*******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_bus_acquire(void) {
+    bus_acquire_count++;
+    return LR11XX_HW_API_SUCCESS;
+}
+
+/*******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_bus_release(void) {
+    return LR11XX_HW_API_SUCCESS;
+}
+
+/*******************************************************************/
+LR11XX_HW_API_status_t LR11XX_HW_API_get_timestamp_us(sfx_u32 *timestamp_us) {
+    (*timestamp_us) = 0;
+    return LR11XX_HW_API_SUCCESS;
+}
+
+/*** Test functions ***/
+
+/*******************************************************************/
+static void _check(int condition, const char *test_name) {
+    test_count++;
+    if (condition == 0) {
+        test_failure_count++;
+        printf("FAIL %s\n", test_name);
+    }
+}
+
+/*******************************************************************/
+static void _coex_granted_cb(void) {
+    coex_granted_count++;
+}
+
+/*******************************************************************/
+static void _reset_counters(void) {
+    spi_transfer_count = 0;
+    bus_acquire_count = 0;
+}
+
+/*******************************************************************/
+static void _test_error_while_external_owner(void) {
+    RF_API_config_t rf_api_config;
+    RF_API_status_t status = RF_API_SUCCESS;
+    memset(&rf_api_config, 0x00, sizeof(rf_api_config));
+    status = LR11XX_RF_API_open(&rf_api_config);
+    _check(status == RF_API_SUCCESS, "open");
+    // Chip is handed over to the external user immediately, no Sigfox sequence is running.
+    status = LR11XX_RF_API_coex_acquire(&_coex_granted_cb);
+    _check(status == RF_API_SUCCESS, "coex acquire");
+    _check(coex_granted_count == 1, "coex granted");
+    _check(LR11XX_RF_API_coex_get_owner() == LR11XX_RF_API_COEX_OWNER_EXTERNAL, "coex owner external");
+    // Wake-up is rejected and the core library reports the error.
+    _reset_counters();
+    status = LR11XX_RF_API_wake_up();
+    _check(status == (RF_API_status_t) LR11XX_RF_API_ERROR_CHIP_BUSY, "wake-up rejected");
+    LR11XX_RF_API_error();
+    _check(spi_transfer_count == 0, "error does not access the chip of the external user");
+    _check(bus_acquire_count == 0, "error does not acquire the bus of the external user");
+    _check(LR11XX_RF_API_coex_get_owner() == LR11XX_RF_API_COEX_OWNER_EXTERNAL, "coex owner kept");
+    // Once released, the error path resets the chip as usual.
+    status = LR11XX_RF_API_coex_release(SIGFOX_FALSE);
+    _check(status == RF_API_SUCCESS, "coex release");
+    _reset_counters();
+    LR11XX_RF_API_error();
+    _check(spi_transfer_count != 0, "error accesses the chip without external user");
+    _check(bus_acquire_count != 0, "error acquires the bus without external user");
+    LR11XX_RF_API_close();
+}
+
+/*******************************************************************/
+int main(void) {
+    _test_error_while_external_owner();
+    printf("%u checks, %u failures\n", test_count, test_failure_count);
+    return (test_failure_count == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}